@@ -23,6 +23,8 @@
 #include <ctime> /* std::clock_t */
 #include <iomanip> /* std::setprecision */
 #include <cstdio> /* printf */
+#include <functional> /* std::function */
+#include <atomic> /* std::atomic */
 
 // ROOT include(s).
 #include "TDirectory.h"
@@ -40,6 +42,7 @@ namespace AnalysisTools {
 // AnalysisTools include(s).
 #include "AnalysisTools/ISelection.h"
 #include "AnalysisTools/Categorised.h"
+#include "AnalysisTools/TaskPool.h"
 
 #include "AnalysisTools/PlotMacro1D.h"
 #include "AnalysisTools/Range.h"
@@ -70,6 +73,18 @@ namespace AnalysisTools {
     void setWeight       (const float* w, const std::string& pattern = "");
     void setSumWeights   (const float* w);
 
+    /**
+     * Run independent selections concurrently, using 'nThreads' threads.
+     *
+     * The selections of each category form a dependency graph, built from the collections passed between them -- the input of each object definition (see ObjectDefinition::setInput), and the collections of each event selection (see EventSelection::addCollection) -- and from the dependencies declared by name (see Selection::addDependency). A selection allowing it (see Selection::setConcurrent) is run as soon as the preceding selections it is linked to have been run: those it depends on, those depending on it, those running the same lazy object definitions (see ObjectDefinition::setLazy), and those which could stop the analysis pipeline before it. Selections not allowing concurrency are run on their own, in the declared order. Results, cutflows and output trees are thus unchanged. Rows of output trees filled in the meantime are buffered per operation and written once all selections have been run (see TreeBuffer).
+     */
+    void setConcurrency  (const unsigned& nThreads);
+
+    /**
+     * Size of the batches in which 'runBuffered' runs the final selection of each category, if it supports batch mode (see EventSelection::runBatch). A 'size' of 0 disables batch mode, such that 'runBuffered' runs each event in full. Does not affect 'run'.
+     */
+    void setBatchSize    (const unsigned& size);
+
 
     // Get method(s).
     const SelectionPtrs&                        selections (const std::string& category) const;
@@ -94,12 +109,30 @@ namespace AnalysisTools {
     bool run (const std::string& category, const unsigned& current, const unsigned& maximum);
     bool run (const std::string& category);
 
+    /**
+     * Batch mode. Called with the index of an event in the batch just run, in the order in which the events were buffered, and whether the event passed all selections, i.e. what 'run' would have returned for it. The buffered event itself is available from the final selection (see EventSelection::batchEvent) during the call.
+     */
+    using BatchCallback = std::function<void(const unsigned& index, const bool& passed)>;
+
+    /**
+     * Batch mode. Run the selections of 'category' on the current event, except for the final one, which only buffers it (see setBatchSize). Once the batch is full, the final selection is run over all buffered events and 'callback' is called for each of them. Events stopped by a required selection before reaching the final one are not buffered, and not reported. Call 'flush' after the event loop to run the remaining buffered events.
+     */
+    void runBuffered (const std::string& category, const BatchCallback& callback);
+
+    // Run the events buffered by 'runBuffered', if any, calling 'callback' for each. Returns the number of events run.
+    unsigned flush (const std::string& category, const BatchCallback& callback);
+
     void save ();
 
     void print ();
 
   protected:
     void setup_ ();
+    void buildGraph_ (const std::string& category);
+    bool runSelections_ (const std::string& category, const ISelection* last, bool& stopped);
+    bool runConcurrently_ (const std::string& category, const ISelection* last, bool& stopped);
+    ISelection* batched_ (const std::string& category) const;
+    void runBatch_ (const std::string& category, ISelection* selection, const BatchCallback& callback);
 
 
   private:
@@ -115,6 +148,24 @@ namespace AnalysisTools {
 
     std::clock_t m_start;
 
+    // Concurrency.
+    std::unique_ptr<TaskPool> m_pool;
+    struct Graph {
+      std::vector<ISelection*> nodes;                // Selections run by the analysis, i.e. not lazy, in the declared order.
+      std::vector< std::vector<unsigned> > inputs;   // Earlier nodes which must have been run before each node.
+      std::vector<unsigned> nextRequired;            // First required node at or after each node, or the number of nodes.
+      std::vector< std::function<void()> > tasks;
+      std::vector<char> results;
+      bool concurrent = false;                       // Whether any two nodes may be run concurrently.
+    };
+    std::map<std::string, Graph> m_graphs;
+    std::atomic<unsigned> m_firstFailure {0}; // First node failing in the current event.
+    unsigned              m_end = 0;      // Number of nodes to run in the current event.
+
+    // Batch mode.
+    unsigned m_batchSize = 0;
+    std::map<std::string, std::vector<char> > m_batchPassed; // Whether each buffered event passed the selections preceding the final one.
+
   };
 
 }
@@ -12,10 +12,13 @@
 #include <map>
 #include <memory> /* std::unique_ptr */
 #include <functional> /* std::function */
+#include <cassert> /* assert */
 
 // ROOT include(s).
 #include "TLorentzVector.h"
 #include "TTreeFormula.h"
+#include "TTree.h"
+#include "TBranch.h"
 
 // AnalysisTools include(s).
 #include "AnalysisTools/Logger.h"
@@ -88,14 +91,51 @@ namespace AnalysisTools {
     {
       addBranches_(branches, prefix);
     };
+
+    /// Destructor(s)
+    // Bound branches, if any (see 'setDirectBinding'), are released from the TTree, which must therefore outlive the retriever.
+    ~CollectionRetriever () {
+      unbind_();
+    };
     
  
   public:
+
+    /// Set method(s).
+    // Whether to read std::vector<float> and std::vector<int> branches directly, through TTree::SetBranchAddress, rather than through TTreeFormulas. Off by default. Other branches, expressions, and branches which already have an address set elsewhere, are always read through formulas. If switched on, the TTree must outlive the retriever, since the branch addresses are reset on destruction.
+    void setDirectBinding (const bool& directBinding = true);
+
     
     /// High-level method(s).
     // Return (masked?) PhysicsObejct content of this collection
     std::vector<PhysicsObject>* result ();
 
+    // Schema of the auxiliary information on the objects in this collection. Keys obtained from it give direct access to the info of these objects, and copies of them.
+    inline InfoSchema& schema () { return m_schema; }
+
+
+  private:
+
+    /**
+     * Branch bound directly to a vector owned by the retriever, through TTree::SetBranchAddress.
+     */
+    struct BranchBinding {
+      std::string name;
+      TBranch* branch = nullptr;
+      int  treeNumber = -1;
+      bool isInt = false;
+      std::vector<float>  floats;
+      std::vector<int>    ints;
+      std::vector<float>* floatsAddress = &floats;
+      std::vector<int>*   intsAddress   = &ints;
+
+      inline unsigned size  () const { return isInt ? intsAddress->size() : floatsAddress->size(); }
+      inline double   value (const unsigned& i) const {
+	assert( i < size() );
+	return isInt ? (*intsAddress)[i] : (*floatsAddress)[i];
+      }
+    };
+
 
   private:
 
@@ -103,6 +143,16 @@ namespace AnalysisTools {
     virtual void clearCache_ ();
     virtual void fillCache_  ();
 
+    virtual bool bind_   (const std::string& branch);
+    virtual void unbind_ ();
+
+    // Read the bound branches for the current entry of the TTree, unless this has already been done, e.g. by TTree::GetEntry.
+    void load_ ();
+
+    // Number of values, and i'th value, of the j'th branch, whether bound or read through a formula.
+    inline unsigned size_  (const unsigned& j) const;
+    inline double   value_ (const unsigned& j, const unsigned& i) const;
+
 
   private:
     
@@ -112,8 +162,28 @@ namespace AnalysisTools {
 
     // Stored cache collection of PhysicsObjects
     std::vector<PhysicsObject> m_collection;
+
+    // Schema shared by all objects in the collection
+    InfoSchema m_schema;
+
+    // Whether to bind vector branches directly.
+    bool m_directBinding = false;
+
+    // Direct bindings, one for each branch (empty if read through a formula), and the TTree to which they are bound.
+    std::vector< std::unique_ptr<BranchBinding> > m_bindings;
+    TTree* m_boundTree = nullptr;
         
   };
+
+
+  // Inline low-level method(s).
+  inline unsigned CollectionRetriever::size_ (const unsigned& j) const {
+    return m_bindings[j] ? m_bindings[j]->size() : m_formulas[j]->GetNdata();
+  }
+
+  inline double CollectionRetriever::value_ (const unsigned& j, const unsigned& i) const {
+    return m_bindings[j] ? m_bindings[j]->value(i) : m_formulas[j]->EvalInstance(i);
+  }
   
 } // namespace
 
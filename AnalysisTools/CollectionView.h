@@ -0,0 +1,151 @@
+#ifndef AnalysisTools_CollectionView_h
+#define AnalysisTools_CollectionView_h
+
+/**
+ * @file CollectionView.h
+ * @author Andreas Sogaard
+ */
+
+// STL include(s).
+#include <vector>
+#include <iterator> /* std::iterator_traits */
+#include <algorithm> /* std::sort, std::partial_sort */
+#include <cassert> /* assert */
+
+// AnalysisTools include(s).
+#include "AnalysisTools/PhysicsObject.h"
+
+namespace AnalysisTools {
+
+    /**
+     * Read-only view of a collection of physics objects, stored elsewhere (typically the result of an ObjectDefinition).
+     *
+     * The view refers to the contiguous array of source objects, and optionally to a list of indices into this array, selecting (and ordering) a subset of the objects. Pointing the view to a collection is therefore free, while the index list is only written once the view is modified (see 'indices'); the source objects themselves are never copied nor modified. The elements are accessed as pointers, as for a vector of pointers to the objects, which the class otherwise mimics.
+     */
+    class CollectionView {
+
+    public:
+
+        // Iterator over the objects in the view, yielding pointers to them.
+        class const_iterator {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type        = const PhysicsObject*;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const value_type*;
+            using reference         = value_type;
+
+            const_iterator (const PhysicsObject* data, const unsigned* indices, const unsigned& i) :
+              m_data(data), m_indices(indices), m_i(i)
+            {};
+
+            inline reference operator* () const { return m_data + (m_indices ? m_indices[m_i] : m_i); }
+            inline const_iterator& operator++ ()    { ++m_i; return *this; }
+            inline const_iterator  operator++ (int) { const_iterator it = *this; ++m_i; return it; }
+            inline const_iterator& operator-- ()    { --m_i; return *this; }
+            inline const_iterator& operator+= (const difference_type& n) { m_i += n; return *this; }
+            inline const_iterator  operator+  (const difference_type& n) const { const_iterator it = *this; return it += n; }
+            inline difference_type operator-  (const const_iterator& other) const { return (difference_type) m_i - (difference_type) other.m_i; }
+            inline bool operator== (const const_iterator& other) const { return m_i == other.m_i; }
+            inline bool operator!= (const const_iterator& other) const { return m_i != other.m_i; }
+            inline bool operator<  (const const_iterator& other) const { return m_i <  other.m_i; }
+
+        private:
+            const PhysicsObject* m_data;
+            const unsigned*      m_indices;
+            unsigned             m_i;
+        };
+
+
+    public:
+
+        // Constructor(s).
+        CollectionView () {};
+        CollectionView (const PhysicsObjects& collection) { reset(collection); }
+
+        // Destructor(s).
+        ~CollectionView () {};
+
+
+    public:
+
+        // Set method(s).
+        // Point the view to all objects in 'collection'. Any index list is dropped, but its storage is kept.
+        void reset (const PhysicsObjects& collection);
+        void clear ();
+
+        // Remove the i'th object from the view.
+        void erase (const unsigned& i);
+
+        // Order the objects in the view according to 'compare', taking two pointers to objects.
+        template <class Compare>
+        void sort (Compare compare);
+
+        // Move the first 'k' objects according to 'compare' to the front of the view, in order, leaving the rest in unspecified order. Cheaper than 'sort' for small 'k'.
+        template <class Compare>
+        void sortLeading (const unsigned& k, Compare compare);
+
+
+        // Get method(s).
+        inline unsigned size  () const { return m_indexed ? m_indices.size() : m_size; }
+        inline bool     empty () const { return size() == 0; }
+
+        inline const PhysicsObject* operator[] (const unsigned& i) const { return m_data + (m_indexed ? m_indices[i] : i); }
+        inline const PhysicsObject* at         (const unsigned& i) const { assert(i < size()); return operator[](i); }
+        inline const PhysicsObject* front      () const { return at(0); }
+        inline const PhysicsObject* back       () const { return at(size() - 1); }
+
+        inline const_iterator begin () const { return const_iterator(m_data, m_indexed ? m_indices.data() : nullptr, 0); }
+        inline const_iterator end   () const { return const_iterator(m_data, m_indexed ? m_indices.data() : nullptr, size()); }
+
+        // Source objects, and the index list, if any.
+        inline const PhysicsObject* data       () const { return m_data; }
+        inline unsigned             sourceSize () const { return m_size; }
+        inline bool                 indexed    () const { return m_indexed; }
+
+        // Indices of the objects in the view, which may be modified to select (or reorder) objects. The list is only written on the first call, i.e. when the view is first modified.
+        std::vector<unsigned>& indices ();
+
+        // Copy of the view as a vector of pointers.
+        PhysicsObjectPtrs pointers () const;
+
+
+    private:
+
+        const PhysicsObject*  m_data    = nullptr;
+        unsigned              m_size    = 0;
+        bool                  m_indexed = false;
+        std::vector<unsigned> m_indices;
+
+    };
+
+
+    // Template method(s).
+    template <class Compare>
+    void CollectionView::sort (Compare compare) {
+        const PhysicsObject* data = m_data;
+        std::vector<unsigned>& idx = indices();
+        std::sort(idx.begin(), idx.end(), [data, &compare] (const unsigned& a, const unsigned& b) {
+            return compare(data + a, data + b);
+          });
+        return;
+    }
+
+    template <class Compare>
+    void CollectionView::sortLeading (const unsigned& k, Compare compare) {
+        const PhysicsObject* data = m_data;
+        std::vector<unsigned>& idx = indices();
+        auto comparator = [data, &compare] (const unsigned& a, const unsigned& b) {
+            return compare(data + a, data + b);
+        };
+        if (k >= idx.size()) {
+            std::sort(idx.begin(), idx.end(), comparator);
+        } else {
+            std::partial_sort(idx.begin(), idx.begin() + k, idx.end(), comparator);
+        }
+        return;
+    }
+
+}
+
+#endif
@@ -7,42 +7,134 @@
  */
 
 // STL include(s).
-// ...
+#include <limits> /* std::numeric_limits */
 
 // AnalysisTools include(s).
 #include "AnalysisTools/PhysicsObject.h"
 #include "AnalysisTools/Event.h"
 #include "AnalysisTools/Cut.h"
+#include "AnalysisTools/Operation.h"
+#include "AnalysisTools/StaticCut.h"
+#include "AnalysisTools/Kernels.h"
+#include "AnalysisTools/RangeSet.h"
+#include "AnalysisTools/CollectionView.h"
 
 namespace AnalysisTools {
 
+  /**
+   * Functors for common object-level cut variables. These are named types, such that the corresponding cuts can keep the function type (see StaticCut) and have it inlined into the loop over candidates. The 'column' methods compute the variable for a whole collection of candidates at once, using the kernels in Kernels.h.
+   */
+  struct ObjectPt {
+    inline float operator() (const PhysicsObject& p) const { return p.Pt(); }
+    inline void  column (const PhysicsObjects& objects, const std::vector<unsigned>& indices, std::vector<float>& values) const { kernelPt(objects, indices, values); }
+  };
+
+  struct ObjectEta {
+    inline float operator() (const PhysicsObject& p) const { return p.Eta(); }
+    inline void  column (const PhysicsObjects& objects, const std::vector<unsigned>& indices, std::vector<float>& values) const { kernelEta(objects, indices, values); }
+  };
+
+  struct ObjectM {
+    inline float operator() (const PhysicsObject& p) const { return p.M(); }
+    inline void  column (const PhysicsObjects& objects, const std::vector<unsigned>& indices, std::vector<float>& values) const { kernelM(objects, indices, values); }
+  };
+
+  struct ObjectInfo {
+    ObjectInfo (const std::string& name, const float& scale = 1.) : name(name), scale(scale) {};
+    inline float operator() (const PhysicsObject& p) const {
+      // Resolve the name once per schema, rather than once per object.
+      if (key.schema != p.schema() && !p.schema()->find(name, key)) { return p.info(name) * scale; }
+      return p.info(key) * scale;
+    }
+    inline void  column (const PhysicsObjects& objects, const std::vector<unsigned>& indices, std::vector<float>& values) const { kernelInfo(objects, indices, name, scale, values); }
+    std::string name;
+    float scale;
+    mutable InfoKey key;
+  };
+
+  /**
+   * Reductions over a collection of physics objects, of one of the variables above (e.g. ObjectInfo, which resolves the info key once per schema rather than once per object). The objects are read in place, through the collection view, and results refer to the objects rather than copying them.
+   */
+
+  // Object with the smallest value of 'variable', or nullptr if there is none. Ties go to the first object; objects with NaN or +inf values are never chosen.
+  template <class Variable>
+  inline const PhysicsObject* collectionArgmin (const CollectionView& objects, const Variable& variable) {
+    const PhysicsObject* best = nullptr;
+    float bestValue = std::numeric_limits<float>::infinity();
+    for (const PhysicsObject* p : objects) {
+      const float value = variable(*p);
+      if (value < bestValue) { best = p; bestValue = value; }
+    }
+    return best;
+  }
+
+  // Object with the largest value of 'variable', or nullptr if there is none. Ties go to the first object; objects with NaN or -inf values are never chosen.
+  template <class Variable>
+  inline const PhysicsObject* collectionArgmax (const CollectionView& objects, const Variable& variable) {
+    const PhysicsObject* best = nullptr;
+    float bestValue = -std::numeric_limits<float>::infinity();
+    for (const PhysicsObject* p : objects) {
+      const float value = variable(*p);
+      if (value > bestValue) { best = p; bestValue = value; }
+    }
+    return best;
+  }
+
+  // Set 'output' to the (at most) 'k' objects with the largest values of 'variable', in decreasing order. Ties keep the order of 'objects'.
+  template <class Variable>
+  inline void collectionTopK (const CollectionView& objects, const Variable& variable, const unsigned& k, CollectionView& output) {
+    output = objects;
+    output.sortLeading(k, [&variable] (const PhysicsObject* a, const PhysicsObject* b) {
+	const float va = variable(*a), vb = variable(*b);
+	return va > vb || (va == vb && a < b);
+      });
+    std::vector<unsigned>& indices = output.indices();
+    if (indices.size() > k) { indices.resize(k); }
+    return;
+  }
+
+  template <class Variable>
+  inline double collectionSum (const CollectionView& objects, const Variable& variable) {
+    double sum = 0.;
+    for (const PhysicsObject* p : objects) { sum += variable(*p); }
+    return sum;
+  }
+
+  // Number of objects for which the value of 'variable' is in 'ranges'.
+  template <class Variable>
+  inline unsigned collectionCountIf (const CollectionView& objects, const Variable& variable, const RangeSet& ranges) {
+    unsigned count = 0;
+    for (const PhysicsObject* p : objects) { count += ranges.contains(variable(*p)); }
+    return count;
+  }
+
+  // Scalar sum of the pT of the objects, e.g. HT for a collection of jets.
+  inline double collectionScalarSumPt (const CollectionView& objects) {
+    return collectionSum(objects, ObjectPt());
+  }
+
   /**
    * Cut on the transverse momentum, pT, of a physics object, in GeV.
    */
-  Cut<PhysicsObject> cut_pt ("pt", [](const PhysicsObject& p) { 
-      return p.Pt(); 
-    });
+  StaticCut<PhysicsObject, ObjectPt> cut_pt ("pt", ObjectPt());
 
   /**
    * Cut on the pseudorapidity, eta, of a physics object.
    */
-  Cut<PhysicsObject> cut_eta ("eta", [](const PhysicsObject& p) { 
-      return p.Eta();
-    });
+  StaticCut<PhysicsObject, ObjectEta> cut_eta ("eta", ObjectEta());
 
   /**
    * Cut on the mass, m, of a physics object, in GeV.
    */
-  Cut<PhysicsObject> cut_m ("m", [](const PhysicsObject& p) { 
-      return p.M();
-    });
+  StaticCut<PhysicsObject, ObjectM> cut_m ("m", ObjectM());
 
   /**
    * Cut on the number of entries in some collection.
    */
   Cut<Event> get_cut_num(const std::string& name) {
-    Cut<Event> cut_num ("Num" + name, [name](const Event& e) { 
-	return e.collection(name).size();
+    const InfoKey key = Event::key(name);
+    Cut<Event> cut_num ("Num" + name, [key](const Event& e) { 
+	return e.collection(key).size();
       });
     return cut_num;
   }
@@ -51,8 +143,9 @@ namespace AnalysisTools {
    * Cut on the value of auxiliary information variable of Event
    */
   inline Cut<Event> get_cut_event_info (const std::string& name, const float& scale = 1.) {
-    Cut<Event> cut (name, [name, scale](const Event& e) {
-        return e.info(name) * scale;
+    const InfoKey key = Event::key(name);
+    Cut<Event> cut (name, [key, scale](const Event& e) {
+        return e.info(key) * scale;
       });
     return cut;
   }
@@ -61,34 +154,104 @@ namespace AnalysisTools {
    * Cut on whether the auxiliary information variable is available to Event
    */
   inline Cut<Event> get_cut_event_hasInfo (const std::string& name) {
-    Cut<Event> cut (name, [name](const Event& e) {
-        return e.hasInfo(name);
+    const InfoKey key = Event::key(name);
+    Cut<Event> cut (name, [key](const Event& e) {
+        return e.hasInfo(key);
       });
     return cut;
   }
 
   /**
-   * Cut on the value of auxiliary information variable of leading PhysicsObject in some collection.
+   * Cut on the value of auxiliary information variable of leading (highest-pt) PhysicsObject in some collection.
    */
   inline Cut<Event> get_cut_event_leading_info (const std::string& collection, const std::string& name, const float& scale = 1.) {
-    Cut<Event> cut ("leading_" + collection + "_" + name, [collection, name, scale](const Event& e) {
-	if (e.collection(collection).size() == 0) {
+    const InfoKey key = Event::key(collection);
+    Cut<Event> cut ("leading_" + collection + "_" + name, [key, name, scale](const Event& e) {
+	const CollectionView& objects = e.leading(key, 1);
+	if (objects.size() == 0) {
 	  return -9999.;
 	}
-        return e.collection(collection).at(0)->info(name) * scale;
+        return objects.at(0)->info(name) * scale;
       });
     return cut;
   }
 
+  /**
+   * Cut on the sum of auxiliary information variable over the PhysicsObjects in some collection.
+   */
+  inline Cut<Event> get_cut_event_sum_info (const std::string& collection, const std::string& name, const float& scale = 1.) {
+    const InfoKey key = Event::key(collection);
+    const ObjectInfo variable (name, scale);
+    Cut<Event> cut ("sum_" + collection + "_" + name, [key, variable](const Event& e) {
+        return collectionSum(e.collection(key), variable);
+      });
+    return cut;
+  }
+
+  /**
+   * Cut on the number of PhysicsObjects in some collection, for which the auxiliary information variable is in 'ranges'.
+   */
+  inline Cut<Event> get_cut_event_count_info (const std::string& collection, const std::string& name, const Ranges& ranges) {
+    const InfoKey key = Event::key(collection);
+    const ObjectInfo variable (name);
+    const RangeSet set (ranges);
+    Cut<Event> cut ("count_" + collection + "_" + name, [key, variable, set](const Event& e) {
+        return collectionCountIf(e.collection(key), variable, set);
+      });
+    return cut;
+  }
+
+  /**
+   * Cut on the scalar sum of pT of the PhysicsObjects in some collection, e.g. HT, in GeV.
+   */
+  inline Cut<Event> get_cut_event_scalar_sum_pt (const std::string& collection) {
+    const InfoKey key = Event::key(collection);
+    Cut<Event> cut ("scalar_sum_pt_" + collection, [key](const Event& e) {
+        return collectionScalarSumPt(e.collection(key));
+      });
+    return cut;
+  }
+
+  /**
+   * Operation setting the named particle to (a reference to) the PhysicsObject in some collection with the smallest value of auxiliary information variable, if any.
+   */
+  inline Operation<Event> get_operation_event_argmin_info (const std::string& collection, const std::string& name, const std::string& particle) {
+    const InfoKey key         = Event::key(collection);
+    const InfoKey particleKey = Event::key(particle);
+    const ObjectInfo variable (name);
+    Operation<Event> operation ("argmin_" + collection + "_" + name, [key, particleKey, variable](Event& e) {
+        const PhysicsObject* p = collectionArgmin(e.collection(key), variable);
+        if (p) { e.setParticle(particleKey, p); }
+        return true;
+      });
+    return operation;
+  }
+
+  /**
+   * Operation setting the named particle to (a reference to) the PhysicsObject in some collection with the largest value of auxiliary information variable, if any.
+   */
+  inline Operation<Event> get_operation_event_argmax_info (const std::string& collection, const std::string& name, const std::string& particle) {
+    const InfoKey key         = Event::key(collection);
+    const InfoKey particleKey = Event::key(particle);
+    const ObjectInfo variable (name);
+    Operation<Event> operation ("argmax_" + collection + "_" + name, [key, particleKey, variable](Event& e) {
+        const PhysicsObject* p = collectionArgmax(e.collection(key), variable);
+        if (p) { e.setParticle(particleKey, p); }
+        return true;
+      });
+    return operation;
+  }
+
   /**
    * Cut on the value of auxiliary information variable of named particle.
    */
   inline Cut<Event> get_cut_event_particle_info (const std::string& particle, const std::string& name, const float& scale = 1.) {
-    Cut<Event> cut (particle + "_" + name, [particle, name, scale](const Event& e) {
-	if (!e.hasParticle(particle)) {
+    const InfoKey key = Event::key(particle);
+    Cut<Event> cut (particle + "_" + name, [key, name, scale](const Event& e) {
+	if (!e.hasParticle(key)) {
 	  return -9999.;
 	}
-        return e.particle(particle).info(name) * scale;
+        return e.particle(key).info(name) * scale;
       });
     return cut;
   }
@@ -96,10 +259,8 @@ namespace AnalysisTools {
   /**
    * Cut on the value of auxiliary information variable of PhysicsObject
    */
-  inline Cut<PhysicsObject> get_cut_object_info (const std::string& name, const float& scale = 1.) {
-    Cut<PhysicsObject> cut (name, [name, scale](const PhysicsObject& p) {
-        return p.info(name) * scale;
-      });
+  inline StaticCut<PhysicsObject, ObjectInfo> get_cut_object_info (const std::string& name, const float& scale = 1.) {
+    StaticCut<PhysicsObject, ObjectInfo> cut (name, ObjectInfo(name, scale));
     return cut;
   }
 
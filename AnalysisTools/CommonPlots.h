@@ -45,15 +45,17 @@ namespace AnalysisTools {
     });
 
 
-   // Standard kinematic of leading PhysicsObject in collection in Event
+   // Standard kinematic of leading (highest-pt) PhysicsObject in collection in Event
   // ---------------------------------------------------------------------------
 
   // Leading PhysicsObject pT.
   inline PlotMacro1D<Event> get_plot_event_leading_pt (const std::string& collection, const float& fallback = -9999.) {
     PlotMacro1D<Event> plot ("leading_" + collection + "_pt");
-    plot.setFunction([collection, fallback](const Event& e) {
-	if (e.collection(collection).size() < 1) { return fallback; }
-	return (float) e.collection(collection).at(0)->Pt();
+    const InfoKey key = Event::key(collection);
+    plot.setFunction([key, fallback](const Event& e) {
+	const CollectionView& objects = e.leading(key, 1);
+	if (objects.size() < 1) { return fallback; }
+	return (float) objects.at(0)->Pt();
       });
     return plot;
   }
@@ -62,9 +64,11 @@ namespace AnalysisTools {
   // Leading PhysicsObject m.
   inline PlotMacro1D<Event> get_plot_event_leading_m (const std::string& collection, const float& fallback = -9999.) {
     PlotMacro1D<Event> plot ("leading_" + collection + "_m");
-    plot.setFunction([collection, fallback](const Event& e) {
-	if (e.collection(collection).size() < 1) { return fallback; }
-	return (float) e.collection(collection).at(0)->M();
+    const InfoKey key = Event::key(collection);
+    plot.setFunction([key, fallback](const Event& e) {
+	const CollectionView& objects = e.leading(key, 1);
+	if (objects.size() < 1) { return fallback; }
+	return (float) objects.at(0)->M();
       });
     return plot;
   }
@@ -73,9 +77,11 @@ namespace AnalysisTools {
   // Leading PhysicsObject E.
   inline PlotMacro1D<Event> get_plot_event_leading_E (const std::string& collection, const float& fallback = -9999.) {
     PlotMacro1D<Event> plot ("leading_" + collection + "_E");
-    plot.setFunction([collection, fallback](const Event& e) {
-	if (e.collection(collection).size() < 1) { return fallback; }
-	return (float) e.collection(collection).at(0)->E();
+    const InfoKey key = Event::key(collection);
+    plot.setFunction([key, fallback](const Event& e) {
+	const CollectionView& objects = e.leading(key, 1);
+	if (objects.size() < 1) { return fallback; }
+	return (float) objects.at(0)->E();
       });
     return plot;
   }
@@ -84,9 +90,11 @@ namespace AnalysisTools {
   // Leading PhysicsObject eta.
   inline PlotMacro1D<Event> get_plot_event_leading_eta (const std::string& collection, const float& fallback = -9999.) {
     PlotMacro1D<Event> plot ("leading_" + collection + "_eta");
-    plot.setFunction([collection, fallback](const Event& e) {
-	if (e.collection(collection).size() < 1) { return fallback; }
-	return (float) e.collection(collection).at(0)->Eta();
+    const InfoKey key = Event::key(collection);
+    plot.setFunction([key, fallback](const Event& e) {
+	const CollectionView& objects = e.leading(key, 1);
+	if (objects.size() < 1) { return fallback; }
+	return (float) objects.at(0)->Eta();
       });
     return plot;
   }
@@ -95,9 +103,11 @@ namespace AnalysisTools {
   // Leading PhysicsObject phi.
   inline PlotMacro1D<Event> get_plot_event_leading_phi (const std::string& collection, const float& fallback = -9999.) {
     PlotMacro1D<Event> plot ("leading_" + collection + "_phi");
-    plot.setFunction([collection, fallback](const Event& e) {
-	if (e.collection(collection).size() < 1) { return fallback; }
-	return (float) e.collection(collection).at(0)->Phi();
+    const InfoKey key = Event::key(collection);
+    plot.setFunction([key, fallback](const Event& e) {
+	const CollectionView& objects = e.leading(key, 1);
+	if (objects.size() < 1) { return fallback; }
+	return (float) objects.at(0)->Phi();
       });
     return plot;
   }
@@ -178,8 +188,9 @@ namespace AnalysisTools {
 
   // ...
   inline PlotMacro1D<Event> get_plot_event_info (const std::string& name, const float& scale = 1.) {
-    PlotMacro1D<Event> plot (name, [name, scale](const Event& e) {
-	return e.info(name) * scale;
+    const InfoKey key = Event::key(name);
+    PlotMacro1D<Event> plot (name, [key, scale](const Event& e) {
+	return e.info(key) * scale;
       });
     return plot;
   }
@@ -191,9 +202,11 @@ namespace AnalysisTools {
   // ...
   inline PlotMacro1D<Event> get_plot_event_leading_info (const std::string& collection, const std::string& name, const float& scale = 1., const float& fallback = -9999.) {
     PlotMacro1D<Event> plot ("leading_" + collection + "_" + name);
-    plot.setFunction([collection, name, scale, fallback](const Event& e) {
-	if (e.collection(collection).size() < 1) { return fallback; }
-	return (float) e.collection(collection).at(0)->info(name) * scale;
+    const InfoKey key = Event::key(collection);
+    plot.setFunction([key, name, scale, fallback](const Event& e) {
+	const CollectionView& objects = e.leading(key, 1);
+	if (objects.size() < 1) { return fallback; }
+	return (float) objects.at(0)->info(name) * scale;
       });
     return plot;
   }
@@ -201,9 +214,11 @@ namespace AnalysisTools {
   // ...
   inline PlotMacro1D<Event> get_plot_event_subleading_info (const std::string& collection, const std::string& name, const float& scale = 1., const float& fallback = -9999.) {
     PlotMacro1D<Event> plot ("subleading_" + collection + "_" + name);
-    plot.setFunction([collection, name, scale, fallback](const Event& e) {
-	if (e.collection(collection).size() < 2) { return fallback; }
-	return (float) e.collection(collection).at(1)->info(name) * scale;
+    const InfoKey key = Event::key(collection);
+    plot.setFunction([key, name, scale, fallback](const Event& e) {
+	const CollectionView& objects = e.leading(key, 2);
+	if (objects.size() < 2) { return fallback; }
+	return (float) objects.at(1)->info(name) * scale;
       });
     return plot;
   }
@@ -13,6 +13,7 @@
 #include <functional> /* std::function */
 #include <cassert> /* assert */
 #include <memory> /* std::unique_ptr */
+#include <algorithm> /* std::remove */
 
 // xAOD include(s)
 // ...
@@ -26,6 +27,9 @@
 namespace  AnalysisTools {
     template <class T, class U>
     class Selection;
+
+    template <class T>
+    class ExpressionCut;
 }
 
 // AnalysisTools include(s).
@@ -35,8 +39,11 @@ namespace  AnalysisTools {
 #include "AnalysisTools/PhysicsObject.h"
 #include "AnalysisTools/Event.h"
 #include "AnalysisTools/Range.h"
+#include "AnalysisTools/RangeSet.h"
 #include "AnalysisTools/PlotMacro1D.h"
 #include "AnalysisTools/ValuesCache.h"
+#include "AnalysisTools/ExecutionPlan.h"
+#include "AnalysisTools/Kernels.h"
 
 using namespace std;
 
@@ -92,6 +99,8 @@ namespace AnalysisTools {
 
 	  this->m_function = other.m_function;
 	  this->m_ranges   = other.m_ranges;
+	  this->m_commutative = other.m_commutative;
+	  this->m_bookkeeping = other.m_bookkeeping;
 
 	  // Copy plotting macros.
 	  for (const auto& pos : { CutPosition::Pre, CutPosition::Post }) {
@@ -104,6 +113,14 @@ namespace AnalysisTools {
 	        
         // Destructor(s).
 	~Cut () {};
+
+
+        // Factory method(s).
+	/**
+	 * Create a cut from a string expression, e.g. "pt > 200 && abs(eta) < 2", which is parsed once into bytecode. See Expression<T> for the supported syntax.
+	 */
+	static ExpressionCut<T> fromExpression (const string& expression);
+	static ExpressionCut<T> fromExpression (const string& name, const string& expression);
         
         
     public:
@@ -131,6 +148,16 @@ namespace AnalysisTools {
 	Cut<T> withRange (const float& value);
         
         void setFunction (const function< float(const T&) >& f);
+
+	/**
+	 * Flag the cut as commutative with its neighbours, such that a selection with cut reordering enabled may evaluate it out of the declared order, relative to other commutative cuts with no operations in between (see CutScheduler). Only pure filters (see 'setBookkeeping') are reordered; cuts with a cutflow bin or trees keep their declared position, since recording them in declared order requires the evaluations made in declared order anyway (see CutScheduler).
+	 */
+	inline void setCommutative (const bool& commutative = true) { m_commutative = commutative; }
+
+	/**
+	 * Whether to book the Precut/Postcut trees and cut variable distributions of the cut, and give it a bin in the cutflow of its selection (default). Without bookkeeping, and unless plots are added explicitly, the cut is a pure filter: nothing is filled per candidate, and the candidates of a collection are tested all at once against the cut ranges (see kernelRanges).
+	 */
+	inline void setBookkeeping (const bool& bookkeeping = true) { assert( !this->m_initialised ); m_bookkeeping = bookkeeping; this->m_origin = 0; }
         
         void clearPlots ();
         void addPlot    (const CutPosition& pos, const IPlotMacro& plot);
@@ -139,11 +166,25 @@ namespace AnalysisTools {
         // Get method(s).
         virtual std::vector< IPlotMacro* > plots (const CutPosition& pos) const;
         virtual std::vector< IPlotMacro* > plots ()                       const;
+
+	inline bool commutative () const { return m_commutative; }
+	inline bool bookkeeping () const { return m_bookkeeping; }
         
 	virtual void print () const;
         
         // High-level management method(s).
-        bool apply (const T& obj, const float& w = 1);
+        virtual bool apply (const T& obj, const float& w = 1);
+        /**
+         * Apply the cut to the objects in 'objects' at the positions 'indices', which are assumed to be in increasing order. The objects are visited from the back, and the indices of the objects failing the cut are removed from 'indices', such that the objects themselves never have to be moved.
+         */
+        virtual void apply (const vector<T>& objects, vector<unsigned>& indices, const float& w = 1);
+
+        /**
+         * Fill the plots and trees of the cut as if it had been applied to 'obj' with outcome 'passes', using the cut variable from the last call to 'apply' on 'source', a copy of this cut (see IOperation::origin). Used for operations shared by several categories, which are only run in one of them (see EventSelection).
+         */
+        inline void replay (const T& obj, const float& w, const Cut<T>& source, const bool& passes);
+
+        virtual Cut<T>* clone () const;
 
         
     protected:
@@ -151,20 +192,196 @@ namespace AnalysisTools {
         // Low-level management method(s).
         void init  ();
         void write ();
+        void compile_ ();
+
+        /**
+         * Implementation of 'apply', templated on the type of the function computing the cut variable. Defined in this header, such that derived classes holding the function by its concrete type (see StaticCut) can have it inlined.
+         */
+        template <class F>
+        bool apply_ (const T& obj, const float& w, const F& f);
+
+        template <class F>
+        void apply_ (const vector<T>& objects, vector<unsigned>& indices, const float& w, const F& f);
+
+        /**
+         * Apply the cut to the objects in 'objects' at the positions 'indices', with the cut variable already computed for each of them in 'values'. The values are tested against the ranges all at once (see kernelRanges), after which the per-object bookkeeping, if any, is done with the resulting pass mask.
+         */
+        void applyColumn_ (const vector<T>& objects, vector<unsigned>& indices, const float& w, const vector<float>& values);
+
+        // Fill the plots and trees for 'obj', with cut variable 'val' and outcome 'passes', not using the values cache.
+        inline void record_ (const T& obj, const float& w, const float& val, const bool& passes);
+
+        // Whether the plots are filled from the parent selection's values cache. Pure filters (see 'setBookkeeping') have no cut variable distribution to read the value from.
+        inline bool caching_ () const { return m_bookkeeping && m_plan.caching(); }
 
         
-    private:
+    protected:
         
         function< float(const T&) > m_function;
-        Ranges m_ranges;
+        RangeSet m_ranges;
+
+        ExecutionPlan<T> m_plan;
+        vector<unsigned char> m_mask;
         
         string m_variable = "";
         string m_unit     = "";
 
+        bool m_commutative = false;
+        bool m_bookkeeping = true;
+
+        float m_value = 0.; // Cut variable of the last object passed to 'apply', for 'replay'.
+
     };
+
+
+    // Templated high-level management method(s).
+    template <class T>
+    template <class F>
+    inline bool Cut<T>::apply_ (const T& obj, const float& w, const F& f) {
+      /**
+       * Performace bottleneck. 
+       * - Is called ca. 20 times per event and;
+       * - accounts for ca. 85% of all instructions/time spend in AnalysisTools.
+       * Everything that doesn't change between calls is therefore resolved 
+       * once, in the execution plan (see 'compile_').
+       */
+        DEBUG("Entering.");
+        assert(m_function);
+        if (!this->m_initialised) { init(); }
+        if (!m_plan.compiled())   { compile_(); }
+
+	if (!caching_()) {
+	  const float val    = f(obj);
+	  const bool  passes = m_ranges.empty() ? (bool) val : m_ranges.contains(val);
+	  m_value = val;
+	  record_(obj, w, val, passes);
+	  DEBUG("Exiting.");
+	  return passes;
+	}
+
+	// Perform caching.
+	m_plan.addToCache(CutPosition::Pre,  obj, w);
+	m_plan.addToCache(CutPosition::Post, obj, w);
+
+	// Compute cut variable.
+        const float val = m_plan.cache()->get("CutVariable");
+        m_value = val;
+
+        // * Pre-cut distributions.
+	DEBUG("  Pre-cut distributions.");
+	m_plan.fillFromCache(CutPosition::Pre);
+        
+        // * Selection.
+	DEBUG("  Selection.");
+        const bool passes = m_ranges.empty() ? (bool) val : m_ranges.contains(val);
+        
+        // * Post-cut distributions.
+	if (passes) {
+	  DEBUG("  Post-cut distributions.");
+	  m_plan.fillFromCache(CutPosition::Post);
+	}
+
+	DEBUG("  Filling trees.");
+	m_plan.fillTrees(passes);
+
+	DEBUG("Exiting.");
+        return passes;
+    }
+
+    template <class T>
+    inline void Cut<T>::record_ (const T& obj, const float& w, const float& val, const bool& passes) {
+        // * Pre-cut distributions.
+        m_plan.fill     (CutPosition::Pre, obj, w);
+        m_plan.fillValue(CutPosition::Pre, val);
+
+        // * Post-cut distributions.
+        if (passes) {
+	    m_plan.fill     (CutPosition::Post, obj, w);
+	    m_plan.fillValue(CutPosition::Post, val);
+        }
+
+        m_plan.fillTrees(passes);
+        return;
+    }
+
+    template <class T>
+    inline void Cut<T>::replay (const T& obj, const float& w, const Cut<T>& source, const bool& passes) {
+        if (!this->m_initialised) { init(); }
+        if (!m_plan.compiled())   { compile_(); }
+
+        if (!caching_()) {
+	    if (!m_plan.empty()) { record_(obj, w, source.m_value, passes); }
+	    return;
+        }
+
+        // As in 'apply_'. The values cached by 'source' are used where present.
+        m_plan.addToCache(CutPosition::Pre,  obj, w);
+        m_plan.addToCache(CutPosition::Post, obj, w);
+        m_plan.fillFromCache(CutPosition::Pre);
+        if (passes) {
+	    m_plan.fillFromCache(CutPosition::Post);
+        }
+        m_plan.fillTrees(passes);
+        return;
+    }
+
+    template <class T>
+    template <class F>
+    inline void Cut<T>::apply_ (const vector<T>& objects, vector<unsigned>& indices, const float& w, const F& f) {
+        // Loop objects from the back, flagging the failing ones, then compact the surviving indices in a single pass.
+        const unsigned N = indices.size();
+        unsigned nFailed = 0;
+        for (unsigned k = N; k --> 0; ) {
+	    if (!apply_(objects[indices[k]], w, f)) {
+	        indices[k] = objects.size();
+	        nFailed++;
+	    }
+        }
+        if (nFailed) {
+	    indices.erase(std::remove(indices.begin(), indices.end(), (unsigned) objects.size()), indices.end());
+        }
+        return;
+    }
+ 
+    template <class T>
+    inline void Cut<T>::applyColumn_ (const vector<T>& objects, vector<unsigned>& indices, const float& w, const vector<float>& values) {
+        assert( values.size() == indices.size() );
+        if (!this->m_initialised) { init(); }
+        if (!m_plan.compiled())   { compile_(); }
+
+        const unsigned N = indices.size();
+        unsigned nFailed = 0;
+        if (caching_()) {
+	    // The plots are filled from the values cache, which is filled one object at a time. Loop objects from the back, such that trees are filled in the same order as by 'apply_'.
+	    for (unsigned k = N; k --> 0; ) {
+	        const float val = values[k];
+	        if (!apply_(objects[indices[k]], w, [val](const T&) { return val; })) {
+		    indices[k] = objects.size();
+		    nFailed++;
+		}
+	    }
+        } else {
+	    kernelRanges(values, m_ranges, m_mask);
+	    const bool record = !m_plan.empty();
+	    for (unsigned k = N; k --> 0; ) {
+	        if (record) { record_(objects[indices[k]], w, values[k], m_mask[k]); }
+	        if (!m_mask[k]) {
+		    indices[k] = objects.size();
+		    nFailed++;
+		}
+	    }
+        }
+        if (nFailed) {
+	    indices.erase(std::remove(indices.begin(), indices.end(), (unsigned) objects.size()), indices.end());
+        }
+        return;
+    }
  
+    /**
+     * Collection of cuts, held by pointer such that derived cuts (e.g. StaticCut, ExpressionCut) keep their type, rather than being sliced to a Cut<T>. Add copies of cuts using 'clone'.
+     */
     template <class T>
-    using Cuts = vector< Cut<T> >;
+    using Cuts = vector< std::unique_ptr< Cut<T> > >;
     
 }
 
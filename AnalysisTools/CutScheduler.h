@@ -0,0 +1,113 @@
+#ifndef AnalysisTools_CutScheduler_h
+#define AnalysisTools_CutScheduler_h
+
+/**
+ * @file CutScheduler.h
+ * @author Andreas Sogaard
+ */
+
+// STL include(s).
+#include <string>
+#include <vector>
+#include <cassert> /* assert */
+#include <chrono> /* std::chrono::steady_clock */
+#include <algorithm> /* std::stable_sort */
+#include <limits> /* std::numeric_limits */
+
+// AnalysisTools include(s).
+#include "AnalysisTools/IOperation.h"
+#include "AnalysisTools/Logger.h"
+
+namespace AnalysisTools {
+
+  /**
+   * Execution order of the operations in a single selection category, adapted to the measured cost and rejection of each cut.
+   *
+   * Consecutive cuts which may be reordered, i.e. with no operations between them, form a group within which the cuts may be evaluated in any order. During a warm-up window of events, the operations are run in the declared order and the time spent in, and the fraction of candidates rejected by, each cut is measured. Afterwards, the cuts in each group are ordered by increasing cost per rejected candidate, and the order is frozen.
+   *
+   * Only cuts which are flagged as commutative (see Cut::setCommutative) and are pure filters, i.e. which record nothing about the candidates they see (see Cut::setBookkeeping), may be reordered. All other cuts keep their position, and see the same candidates in the same order regardless of the order within the groups before them. Cutflows, trees and distributions are therefore identical to those in declared order, both during and after the warm-up window, and between runs.
+   *
+   * Reordering is thus only partly supported: cuts with bookkeeping, which is the default, are never moved, even if flagged as commutative. Filling their cutflow bins and trees in declared order needs, for each candidate, the outcome and cut variable of every such cut up to the first one it fails in declared order, i.e. exactly the evaluations made in declared order. Evaluating them in another order, and filling the cutflow and trees afterwards, could therefore only add work. To have e.g. an expensive substructure cut evaluated after a cheap kinematic one declared later, both must be pure filters; the cutflow then has no bins for them.
+   */
+  class CutScheduler : public Logger {
+
+  public:
+
+    /// Constructor(s).
+    CutScheduler () {};
+
+
+  public:
+
+    /// Set method(s).
+    /**
+     * Initialise from the operations of a category, in declared order. 'reorderable' flags, for each operation, whether it is a cut which may be reordered (see above). No cuts are moved across 'branch', if given.
+     */
+    void init (const std::vector<IOperation*>& operations, const std::vector<bool>& reorderable, const unsigned& warmup, const unsigned& branch = 0);
+
+
+    /// Get method(s).
+    inline bool initialised () const { return m_initialised; }
+    inline bool measuring   () const { return m_measuring; }
+
+    // Index (in declared order) of the operation to be run as the i'th.
+    inline const std::vector<unsigned>& order () const { return m_order; }
+
+
+    /// High-level management method(s).
+    // Record the outcome of applying operation 'i' to 'nIn' candidates, of which 'nPassed' passed, taking 'time' seconds.
+    inline void record (const unsigned& i, const unsigned& nIn, const unsigned& nPassed, const double& time) {
+      m_stats[i].nIn     += nIn;
+      m_stats[i].nPassed += nPassed;
+      m_stats[i].time    += time;
+      return;
+    }
+
+    // End the current event; reorders once the warm-up window is over.
+    void end ();
+
+
+  private:
+
+    /// Low-level management method(s).
+    void reorder_ ();
+
+
+  private:
+
+    /// Utility struct(s).
+    struct Stats {
+      double   time    = 0.;
+      unsigned nIn     = 0;
+      unsigned nPassed = 0;
+    };
+
+
+  private:
+
+    /// Data member(s).
+    bool m_initialised = false;
+    bool m_measuring   = false;
+
+    unsigned m_warmup = 0;
+    unsigned m_events = 0;
+
+    std::vector<std::string> m_names;
+    std::vector<unsigned>    m_order;
+    std::vector<Stats>       m_stats;
+
+    std::vector< std::vector<unsigned> > m_groupMembers;
+
+  };
+
+
+  /**
+   * Utility for timing operations during the warm-up window.
+   */
+  inline double schedulerTime () {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+} // namespace
+
+#endif
@@ -10,8 +10,11 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <list>
 #include <cassert> /* assert */
 #include <memory> /* shared_ptr */
+#include <functional> /* std::function */
+#include <limits> /* std::numeric_limits */
 
 // ROOT include(s).
 #include "TLorentzVector.h"
@@ -19,6 +22,8 @@
 // AnalysisTools include(s).
 #include "AnalysisTools/Utilities.h"
 #include "AnalysisTools/PhysicsObject.h"
+#include "AnalysisTools/CollectionView.h"
+#include "AnalysisTools/InfoSchema.h"
 #include "AnalysisTools/GRL.h"
 #include "AnalysisTools/Logger.h"
 
@@ -26,6 +31,13 @@ using namespace std;
 
 namespace AnalysisTools {
 
+    /**
+     * Event-level information: auxiliary info values, (views of) collections of physics objects, and named particles.
+     *
+     * All names are resolved to slots in a single schema shared by all events (see 'key'), and the contents are stored in flat arrays indexed by these slots. Clearing an event only marks the slots as empty, such that the allocated storage is reused from one event to the next. Each method taking a name has an overload taking the corresponding key, which skips the name lookup.
+     *
+     * An event may be layered on top of a (read-only) base event, see 'setBase'. Content added to the event is stored in the event itself, and lookups fall back to the base for any slot not set here. This allows e.g. the categories of an EventSelection to share the retrieved content, each only storing what its own operations add. A collection from the base is copied into the event once it is modified, see 'mutableCollection'.
+     */
     class Event : public Logger {
         
     public:
@@ -38,39 +50,146 @@ namespace AnalysisTools {
         
         
     public:
+
+        // Schema method(s).
+        // Key for 'name', valid for all events. Resolve once, outside the event loop, and use in place of the name. Only the set methods register names; the get methods taking a name leave the schema unchanged.
+        static InfoKey     key    (const string& name);
+        static InfoSchema* schema ();
         
         // Set method(s).
         void addInfo       (const string& name, const float&   val);
+        void addInfo       (const InfoKey& key, const float&   val);
+        // Bind info to a variable, which is read on each access rather than copied. The variable must outlive the binding.
+        template<class T>
+        void bindInfo      (const string& name, const T* address);
+        template<class T>
+        void bindInfo      (const InfoKey& key, const T* address);
         void addCollection (const string& name, PhysicsObjects* collection);
+        void addCollection (const InfoKey& key, PhysicsObjects* collection);
+        void addCollection (const string& name, const function< PhysicsObjects*() >& trigger); // Resolved on first access.
+        void addCollection (const InfoKey& key, const function< PhysicsObjects*() >& trigger);
         void addGRL        (GRL* grl);
         void setParticle   (const string& name, const PhysicsObject& particle);
+        void setParticle   (const InfoKey& key, const PhysicsObject& particle);
+        // Refer to an object, e.g. in a collection, rather than copying it. The object must outlive its use through this event.
+        void setParticle   (const string& name, const PhysicsObject* particle);
+        void setParticle   (const InfoKey& key, const PhysicsObject* particle);
+        // Event on which this one is layered. The base must outlive its use by this event.
+        void setBase       (const Event* base);
         
         // Get method(s).
         bool  hasCollection (const string& name) const;
+        bool  hasCollection (const InfoKey& key) const;
+
+	const CollectionView&        collection (const string& name) const;
+	const CollectionView&        collection (const InfoKey& key) const;
+      	      CollectionView& mutableCollection (const string& name);
+      	      CollectionView& mutableCollection (const InfoKey& key);
 
-	const PhysicsObjectPtrs&        collection (const string& name) const;
-      	      PhysicsObjectPtrs& mutableCollection (const string& name);
+	// View of a collection with its 'k' leading objects first, in order of decreasing pt, or of decreasing value of the info 'by' of the objects. The ordering is memoised for the rest of the event, until the collection is modified (including through 'mutableCollection'), and only computes as much as needed for 'k'.
+	const CollectionView& leading (const string& name, const unsigned& k = std::numeric_limits<unsigned>::max(), const string& by = "") const;
+	const CollectionView& leading (const InfoKey& key, const unsigned& k = std::numeric_limits<unsigned>::max(), const string& by = "") const;
 
-        float               info     (const string& name) const;
+        float                info     (const string& name) const;
+        inline float         info     (const InfoKey& key) const;
         bool                 hasInfo  (const string& name) const;
+        inline bool          hasInfo  (const InfoKey& key) const;
         const PhysicsObject& particle (const string& name) const;
+        const PhysicsObject& particle (const InfoKey& key) const;
         bool                 hasParticle (const string& name) const;
+        bool                 hasParticle (const InfoKey& key) const;
         GRL*                 grl      ()                   const;
+        const Event*         base     ()                   const { return m_base; }
         
         
         // High-level management method(s).
-	void clear ();
+	// Remove the contents of this event, keeping the base.
+	void clear  ();
+	// Copy the contents of 'other', including its base, keeping the storage already allocated by this event.
+	void assign (const Event& other);
+	// Copy the contents of 'other', including those of its bases, such that this event refers to no other event nor variable: bound info is read, pending collections are produced, particles set by reference are copied, and objects reading their info from columns are detached (see PhysicsObject::detach). The objects in the collections are copied, in the order of their views, into 'storage', which must outlive this event.
+	void snapshot (const Event& other, std::list<PhysicsObjects>& storage);
         
         
     private:
+
+        // State of a slot. Pending collections are produced on first access; bound info and particles are read through a pointer.
+        enum SlotState : unsigned char { Empty = 0, Set, Pending, Bound };
+
+        // Variable bound to an info slot, and its type.
+        enum BindingType : unsigned char { Unsigned = 0, Double, Float, Bool, Int };
+        struct Binding {
+          const void* address = nullptr;
+          BindingType type    = Float;
+        };
+
         
-        map<string, float> m_info;
-	map<string, PhysicsObjectPtrs > m_collections;
-        map<string, PhysicsObject> m_particles;
+    private:
+
+        // Contents, indexed by slot. All arrays have the same size.
+        vector<float>          m_info;
+        vector<unsigned char>  m_infoStates;
+        vector<Binding>        m_bindings;
+	mutable vector<CollectionView>                    m_collections;
+	mutable vector< function< PhysicsObjects*() > >   m_triggers;
+	mutable vector<unsigned char>                     m_collectionStates;
+        vector<PhysicsObject>  m_particles;
+        vector<const PhysicsObject*> m_particleRefs; // For particles set by reference.
+        vector<unsigned char>  m_particleStates;
         GRL* m_grl = nullptr;
+        const Event* m_base = nullptr;
+
+
+        // Memoised ordering of a collection, see 'leading'.
+        struct Ordering {
+          string         by;
+          unsigned       k     = 0;
+          bool           valid = false;
+          CollectionView view;
+        };
+	mutable vector< list<Ordering> > m_orderings; // Indexed by slot; only sized once orderings are requested. Lists, such that views handed out stay in place.
+
+
+    private:
+
+        // Low-level management method(s).
+        void grow_    (const unsigned& slot);
+        void resolve_ (const unsigned& slot) const;
+        void invalidate_ (const unsigned& slot) const;
+        bool has_     (const vector<unsigned char>& states, const InfoKey& key) const;
+        inline float bound_ (const unsigned& slot) const;
         
     };
 
+
+    // Inline get method(s).
+    inline float Event::info (const InfoKey& key) const {
+        if (has_(m_infoStates, key)) { return (m_infoStates[key.slot] == Bound ? bound_(key.slot) : m_info[key.slot]); }
+        if (m_base) { return m_base->info(key); }
+        ERROR("No info named '%s' exists.", schema()->name(key.slot).c_str());
+    }
+
+    inline bool Event::hasInfo (const InfoKey& key) const {
+        return has_(m_infoStates, key) || (m_base && m_base->hasInfo(key));
+    }
+
+    inline bool Event::has_ (const vector<unsigned char>& states, const InfoKey& key) const {
+        assert(key.schema == schema());
+        return key.slot < states.size() && states[key.slot] != Empty;
+    }
+
+    inline float Event::bound_ (const unsigned& slot) const {
+        const Binding& binding = m_bindings[slot];
+        switch (binding.type) {
+          case Unsigned: return *static_cast<const unsigned*>(binding.address);
+          case Double:   return *static_cast<const double*>  (binding.address);
+          case Float:    return *static_cast<const float*>   (binding.address);
+          case Bool:     return *static_cast<const bool*>    (binding.address);
+          case Int:      return *static_cast<const int*>     (binding.address);
+        }
+        return 0;
+    }
+
     using Events = vector<Event>;
     
 }
@@ -0,0 +1,134 @@
+#ifndef AnalysisTools_EventArena_h
+#define AnalysisTools_EventArena_h
+
+/**
+ * @file   EventArena.h
+ * @author Andreas Sogaard
+ * @brief  Per-event monotonic memory arena, and an allocator drawing from it.
+ */
+
+// STL include(s).
+#include <cstddef> /* std::size_t */
+#include <new> /* ::operator new, ::operator delete */
+#include <type_traits> /* std::true_type */
+
+namespace AnalysisTools {
+
+  /**
+   * Monotonic arena for memory which only lives for the duration of an event, e.g. the auxiliary information of the physics objects created in each event.
+   *
+   * Memory is handed out by bumping a pointer through a list of large blocks, and is never freed individually. Instead, all of it is reused once the next event starts (see 'reset'). The blocks are kept, such that, after the first few events, no memory is requested from the global heap at all. Each thread has its own arena, so allocation needs no synchronisation.
+   *
+   * The arena is switched off by default. If switched on, 'reset' must be called at the start of each event, before any objects are retrieved, and containers drawing from the arena (see ArenaAllocator) must not be read after the following call to 'reset', only destroyed or assigned to.
+   *
+   * Objects kept beyond the event must therefore be moved to the heap, see PhysicsObject::detach. This is done for the events buffered in batch mode (see EventSelection::buffer), which are run in a later event. The results of a lazy object definition are dropped for each new event, rather than kept until it is next demanded (see ObjectDefinition::setLazy). Otherwise, the results of selections which were not run in the current event, e.g. since the pipeline stopped before them, must not be read.
+   */
+  class EventArena {
+
+  public:
+
+    /// Set method(s).
+    static void setEnabled (const bool& enabled);
+
+    /// Get method(s).
+    static bool enabled ();
+
+    // Current event generation; incremented by each call to 'reset'. Zero is never used.
+    static unsigned generation ();
+
+    /// High-level management method(s).
+    // Start a new event, making all memory handed out so far available again.
+    static void reset ();
+
+    // Allocate 'bytes' bytes, with the given alignment, from the calling thread's arena.
+    static void* allocate (const std::size_t& bytes, const std::size_t& alignment);
+
+  };
+
+
+  /**
+   * Standard-conforming allocator which draws from the EventArena, if switched on, and from the global heap otherwise.
+   *
+   * Each allocator is tagged with the event generation in which it was created (or zero for the heap). Allocators from different generations compare unequal and are propagated on assignment, such that a container from a previous event which is assigned to releases its (stale) storage and allocates anew, rather than writing into memory which has since been reused.
+   */
+  template <class T>
+  class ArenaAllocator {
+
+  public:
+
+    /// Type(s).
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+
+    template <class U>
+    struct rebind { using other = ArenaAllocator<U>; };
+
+
+  public:
+
+    /// Constructor(s).
+    ArenaAllocator () :
+      m_generation(EventArena::enabled() ? EventArena::generation() : 0)
+    {};
+
+    template <class U>
+    ArenaAllocator (const ArenaAllocator<U>& other) :
+      m_generation(other.generation())
+    {};
+
+
+  public:
+
+    // Allocator drawing from the global heap regardless of the arena, for containers kept beyond the current event.
+    static inline ArenaAllocator heap () {
+      ArenaAllocator allocator;
+      allocator.m_generation = 0;
+      return allocator;
+    }
+
+
+  public:
+
+    /// Get method(s).
+    inline unsigned generation () const { return m_generation; }
+
+
+    /// High-level management method(s).
+    inline T* allocate (std::size_t n) {
+      if (m_generation == 0) {
+	return static_cast<T*>(::operator new(n * sizeof(T)));
+      }
+      return static_cast<T*>(EventArena::allocate(n * sizeof(T), alignof(T)));
+    }
+
+    inline void deallocate (T* p, std::size_t /*n*/) {
+      // Arena memory is reclaimed all at once, by EventArena::reset.
+      if (m_generation == 0) {
+	::operator delete(p);
+      }
+    }
+
+    // Copies of a container draw from the arena of the current event, regardless of where the original lives.
+    inline ArenaAllocator select_on_container_copy_construction () const {
+      return ArenaAllocator();
+    }
+
+
+  private:
+
+    /// Data member(s).
+    unsigned m_generation;
+
+  };
+
+  template <class T, class U>
+  inline bool operator== (const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) { return a.generation() == b.generation(); }
+
+  template <class T, class U>
+  inline bool operator!= (const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) { return !(a == b); }
+
+} // namespace
+
+#endif // AnalysisTools_EventArena_h
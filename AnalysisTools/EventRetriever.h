@@ -55,6 +55,10 @@ namespace AnalysisTools {
     /// Data member(s)
     // Stored Event.
     Event m_event;
+
+    // Event keys for the branches and functions, resolved on the first retrieval.
+    std::vector<InfoKey> m_branchKeys;
+    std::vector<InfoKey> m_functionKeys;
         
   };
   
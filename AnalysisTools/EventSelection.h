@@ -16,6 +16,8 @@
 #include <algorithm> /* std::count_if */
 #include <typeinfo> /* std::bad_cast */
 #include <utility> /* std::make_pair */
+#include <list> /* std::list */
+#include <deque> /* std::deque */
 
 // ROOT include(s).
 // ..
@@ -73,9 +75,38 @@ namespace AnalysisTools {
         
         // High-level management method(s).
         virtual bool run ();
+
+	/**
+	 * Batch mode. Buffer the current event, as it would be seen by the operations in 'run', to be run later by 'runBatch' together with the other buffered events.
+	 *
+	 * Only what the operations can read is copied: the input event (see setInput) and the basic info, once for all categories, and the collections linked to each category (see addCollection), once per source collection. Objects reading their info from columns are detached (see PhysicsObject::detach). The buffered event thus refers to no variable, column or collection outside the selection, such that the selection's inputs can move on to the next event. Collections of lazy object definitions are therefore produced when the event is buffered. The current selection weight is stored with the event.
+	 */
+	virtual void buffer ();
+	virtual inline bool     batchable () const { return true; }
+	virtual inline unsigned buffered  () const { return (m_batchRun ? 0 : m_nBuffered); }
+
+	/**
+	 * Run the selection over all events buffered since the last call.
+	 *
+	 * Each operation is applied to all events still surviving in a given category before moving on to the next operation. The values cache, and the plots and trees of the operations are filled per event, in the order in which the events were buffered, such that these outputs are identical to running the selection on each event in turn. The operations must therefore only depend on the event they are given. The results for each event are available through 'result(category, index)', 'batchResult' and 'batchEvent' until the next event is buffered.
+	 *
+	 * Each cutflow bin is filled once per operation and batch, with the sum of the weights of the events passing, and the sum of their squares. The bin contents, their errors (Sumw2, enabled as by TH1::Fill for weights other than 1), the number of entries and the statistics are the same as from filling the bin for each event, up to the rounding of the sums.
+	 *
+	 * \return Whether any event passed any category.
+	 */
+	virtual bool runBatch ();
+	virtual bool batchResult (const unsigned& index) const;
+
+	/**
+	 * Whether the selection depends on the output of 'other', i.e. whether 'other' has been declared as a dependency (see Selection::addDependency), or is an object definition producing one of the collections linked to any category (see addCollection). Selections of other types are conservatively assumed to be depended on.
+	 */
+	virtual bool dependsOn (ISelection* other);
         
         bool result ();
         bool result (const string& category);
+        bool result (const string& category, const unsigned& index);
+
+	const Event& batchEvent (const string& category, const unsigned& index) const;
 
 	virtual void print () const;
         
@@ -83,22 +114,75 @@ namespace AnalysisTools {
   private:
         
         // Internal methods(s)
-	void cacheCollections_ ();
+	void  cacheCollections_ ();
+	void  findSharedPrefix_ ();
+	float weight_ () const;
+
+	void prepareSharedEvent_ ();
+	void prepareEvent_  (const string& category);
+	template<class T>
+	void bindBasicInfo_ (std::vector<InfoKey>& keys);
+	bool runOperations_ (const string& category, const unsigned& begin, const unsigned& end, const std::vector<TH1F*>& cutflows, const float& weight, unsigned& iCut);
+	void runBatchOperations_ (const string& category, const unsigned& begin, const unsigned& end, const std::vector<TH1F*>& cutflows, std::vector<unsigned>& survivors, unsigned& iCut);
+	void fillBatchCutflow_   (TH1F* cutflow, const unsigned& iCut, const std::vector<unsigned>& events) const;
+	bool applyOperation_ (const string& category, const unsigned& i, Event& event, const float& weight);
         
 
   private:
         
 	const Event* m_input = nullptr;
+        Event                m_sharedEvent;    // Copy of the input event.
+        Event                m_basicInfoEvent; // Basic info, bound to the user's variables and layered on the input event. The event of each category is layered on this.
         map< string, Event > m_events;
         map< string, bool >  m_passes;
 	map< string, std::vector<std::tuple<string, string, string> > > m_collectionNames;
 	map< string, map< string, PhysicsObjects* > >     m_collectionLinks;
+	map< string, map< string, function< PhysicsObjects*() > > > m_collectionTriggers; // For lazy object definitions.
+
+	// The above, with the collection names resolved to event keys once, in 'cacheCollections_'.
+	struct CollectionLink {
+	  InfoKey key;
+	  PhysicsObjects* collection;
+	  function< PhysicsObjects*() > trigger;
+	};
+	map< string, std::vector<CollectionLink> > m_links;
+
+	PhysicsObjects* copyCollection_ (const CollectionLink& link, std::list<PhysicsObjects>& storage);
+
+	// Event keys for the (bound) basic info, per type, in the order of the info containers.
+	std::vector< std::vector<InfoKey> > m_basicInfoKeys = std::vector< std::vector<InfoKey> >(5);
+
+	// Cutflows filled by each call to 'runOperations_'; kept, to avoid allocating for each event.
+	std::vector<TH1F*> m_runCutflows;
+
+	// Batch mode. Buffered events, per category, each layered on the copy of the input event and basic info shared by all categories, which also stores the copies of the linked collections. Deques, such that the events stay in place as more are buffered.
+	struct BatchEvent {
+	  Event event;
+	  bool passes = false;
+	};
+	struct BatchInput {
+	  Event event;
+	  std::list<PhysicsObjects> objects;
+	};
+	map< string, std::deque<BatchEvent> > m_batchEvents;
+	std::deque<BatchInput>  m_batchInputs;
+	std::vector< std::pair<const PhysicsObjects*, PhysicsObjects*> > m_batchCopies; // Source collections copied for the event being buffered, and their copies.
+	std::deque<ValuesCache> m_batchCaches;  // Values cache of each buffered event, shared by all categories as in 'run'.
+	std::vector<float>      m_batchWeights;
+	std::vector<unsigned>   m_batchSurvivors;
+	std::vector<unsigned>   m_batchSharedSurvivors; // Events passing the operations shared by all categories.
+	unsigned m_nBuffered = 0;
+	bool     m_batchRun  = false;
 
 	// Structure of m_collectionNamses:
 	// vector[ (name-of-collection, name-of-objdef-from-which-to-get-collection, objdef-category) ]
 
 	bool m_hasCachedCollections = false;
 
+	// Number of operations shared by all categories, i.e. before the branch point, which are run only once per event, on the first category. The plots and trees of the copies in the other categories are filled alongside (see Cut::replay).
+	unsigned m_sharedPrefix = 0;
+	bool m_hasFoundSharedPrefix = false;
+
     };
 
 }
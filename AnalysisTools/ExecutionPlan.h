@@ -0,0 +1,146 @@
+#ifndef AnalysisTools_ExecutionPlan_h
+#define AnalysisTools_ExecutionPlan_h
+
+/**
+ * @file ExecutionPlan.h
+ * @author Andreas Sogaard
+ */
+
+// STL include(s).
+#include <string>
+#include <vector>
+#include <cassert> /* assert */
+
+// ROOT include(s).
+#include "TTree.h"
+
+// AnalysisTools include(s).
+#include "AnalysisTools/IOperation.h"
+#include "AnalysisTools/IPlotMacro.h"
+#include "AnalysisTools/ISelection.h"
+#include "AnalysisTools/PlotMacro1D.h"
+#include "AnalysisTools/ValuesCache.h"
+#include "AnalysisTools/TaskPool.h"
+#include "AnalysisTools/TreeBuffer.h"
+
+namespace AnalysisTools {
+
+  /**
+   * Flat, pre-resolved description of the work performed by a single Cut or Operation each time it is applied.
+   *
+   * The plan is compiled once, after the operation has been initialised, and resolves everything that doesn't change from call to call: the parent selection and its values cache, the split of plotting macros into weight- and object-type fills, and the output trees. Applying the operation then only has to walk flat arrays of typed pointers, without any heap allocation, dynamic casts, or string comparisons.
+   */
+  template <class T>
+  class ExecutionPlan {
+
+  public:
+
+    /// Utility struct(s).
+    struct Entry {
+      IPlotMacro*         plot   = nullptr;
+      PlotMacro1D<float>* weight = nullptr; // Set if the plot is filled with the event weight.
+      PlotMacro1D<T>*     object = nullptr; // Set if the plot is filled from the object itself.
+      std::string         key    = "";      // Key in the parent selection's values cache.
+      bool                cache  = true;    // Whether to add the value to the cache.
+    };
+
+    struct Stage {
+      std::vector< PlotMacro1D<float>* > weights;
+      std::vector< PlotMacro1D<T>* >     objects;
+      std::vector< IPlotMacro* >         values;  // Filled with the value computed by the operation itself.
+      std::vector< Entry >               entries;
+      TTree* tree = nullptr;
+      TreeBuffer buffer; // Rows of 'tree' filled while running concurrently.
+    };
+
+
+  public:
+
+    /// Set method(s).
+    void compile (ILocalised* parent,
+		  const std::vector< IPlotMacro* >& pre,
+		  const std::vector< IPlotMacro* >& post,
+		  TTree* preTree,
+		  TTree* postTree,
+		  const std::string& variable = "");
+
+    inline void invalidate () { m_compiled = false; }
+
+
+    /// Get method(s).
+    inline bool         compiled () const { return m_compiled; }
+    inline ISelection*  parent   () const { return m_parent; }
+    inline ValuesCache* cache    () const { return m_cache; }
+    inline bool         caching  () const { return m_parent && m_parent->performCaching(); }
+
+    // Whether there is nothing to fill when applying the operation, i.e. no plots and no trees.
+    inline bool empty () const { return m_pre.entries.empty() && m_post.entries.empty() && !m_pre.tree && !m_post.tree; }
+
+
+    /// High-level management method(s).
+    // Fill all plots at 'pos' directly from the object and event weight.
+    inline void fill (const CutPosition& pos, const T& obj, const float& w) {
+      const Stage& s = stage(pos);
+      for (PlotMacro1D<float>* plot : s.weights) { plot->fill(w); }
+      for (PlotMacro1D<T>*     plot : s.objects) { plot->fill(obj); }
+      return;
+    }
+
+    // Fill all plots at 'pos' showing the value computed by the operation, without re-evaluating it.
+    inline void fillValue (const CutPosition& pos, const float& val) {
+      for (IPlotMacro* plot : stage(pos).values) { plot->fillDirectly(val); }
+      return;
+    }
+
+    // Add the values of all plots at 'pos' to the parent selection's values cache.
+    void addToCache (const CutPosition& pos, const T& obj, const float& w);
+
+    // Fill all plots at 'pos' from the parent selection's values cache.
+    void fillFromCache (const CutPosition& pos);
+
+    // Fill the pre-cut tree, and the post-cut tree if the operation was passed. While running concurrently, the rows are instead buffered, to be written by the parent selection (see ISelection::defer).
+    inline void fillTrees (const bool& passes) {
+      if (!m_pre.tree) { return; }
+      if (m_parent && TaskPool::inTask()) {
+	defer_(m_pre);
+	if (passes) {
+	  defer_(m_post);
+	}
+	return;
+      }
+      m_pre.tree->Fill();
+      if (passes) {
+	m_post.tree->Fill();
+      }
+      return;
+    }
+
+
+  private:
+
+    /// Low-level management method(s).
+    inline const Stage& stage (const CutPosition& pos) const { return (pos == CutPosition::Pre ? m_pre : m_post); }
+    inline void defer_ (Stage& stage) {
+      if (stage.buffer.empty()) { m_parent->defer(&stage.buffer); }
+      stage.buffer.add();
+      return;
+    }
+    void compileStage_ (Stage& stage, const std::vector< IPlotMacro* >& plots, TTree* tree, const std::string& variable, const bool& post);
+
+
+  private:
+
+    /// Data member(s).
+    bool m_compiled = false;
+
+    ISelection*  m_parent = nullptr;
+    ValuesCache* m_cache  = nullptr;
+
+    Stage m_pre;
+    Stage m_post;
+
+  };
+
+} // namespace
+
+#endif
@@ -0,0 +1,162 @@
+#ifndef AnalysisTools_Expression_h
+#define AnalysisTools_Expression_h
+
+/**
+ * @file   Expression.h
+ * @author Andreas Sogaard
+ * @brief  Run-time cut expressions, compiled to a small stack-based bytecode.
+ */
+
+// STL include(s).
+#include <string> /* std::string */
+#include <vector> /* std::vector */
+#include <cassert> /* assert */
+
+// ROOT include(s).
+#include "TLorentzVector.h"
+
+// AnalysisTools include(s).
+#include "AnalysisTools/Logger.h"
+#include "AnalysisTools/PhysicsObject.h"
+#include "AnalysisTools/Event.h"
+
+namespace AnalysisTools {
+
+  /**
+   * Arithmetic/boolean expression over the properties of an object of type T, parsed once from a string and evaluated through a flat bytecode.
+   *
+   * Grammar (C-like precedence):
+   *   expr    := or
+   *   or      := and ('||' and)*
+   *   and     := cmp ('&&' cmp)*
+   *   cmp     := sum [('<' | '<=' | '>' | '>=' | '==' | '!=') sum]
+   *   sum     := product (('+' | '-') product)*
+   *   product := unary (('*' | '/') unary)*
+   *   unary   := ('-' | '!') unary | primary
+   *   primary := number | '(' expr ')' | function '(' args ')' | variable
+   *
+   * Functions: abs, sqrt, log, exp, min, max, pow, and info(name).
+   * Variables:
+   *   - TLorentzVector, PhysicsObject: pt, eta, phi, m, e, px, py, pz.
+   *   - Event: any bare name is read as event info; additionally hasInfo(name) and num(collection).
+   *
+   * Boolean operators evaluate both sides (no short-circuiting), and yield 1 or 0. All arithmetic is done in single precision, as for Cut<T>.
+   *
+   * Besides evaluating a single object, a whole array of objects can be evaluated at once. In that case each instruction is applied to an entire column of values in a tight loop, rather than interpreting the bytecode once per object.
+   */
+  template<class T>
+  class Expression : public Logger {
+
+  public:
+
+    /// Utility enum(s) and struct(s).
+    enum class OpCode : unsigned char {
+      Constant,
+      // Loads.
+      Pt, Eta, Phi, M, E, Px, Py, Pz, Info, HasInfo, Num,
+      // Unary operations.
+      Neg, Not, Abs, Sqrt, Log, Exp,
+      // Binary operations.
+      Add, Sub, Mul, Div, Pow, Min, Max, Lt, Le, Gt, Ge, Eq, Ne, And, Or
+    };
+
+    struct Instruction {
+      OpCode   op;
+      float    value;
+      unsigned index; // Index into the table of names, for loads by name.
+    };
+
+
+  public:
+
+    /// Constructor(s).
+    Expression (const std::string& expression);
+
+
+  public:
+
+    /// Get method(s).
+    inline const std::string&              expression   () const { return m_expression; }
+    inline const std::vector<Instruction>& instructions () const { return m_instructions; }
+    inline const std::vector<std::string>& names        () const { return m_names; }
+
+
+    /// High-level management method(s).
+    // Resolve the info names in the expression to slots in 'schema', registering them if needed. Called on construction, with the default schema. For PhysicsObject, the names are resolved once for each other schema used by the objects evaluated, on first use, and the keys are kept for each schema.
+    void resolve (InfoSchema* schema = InfoSchema::global());
+
+    // Evaluate the expression for a single object.
+    float evaluate (const T& obj) const;
+
+    // Evaluate the expression for each of the objects in 'objects', storing the results in 'values'.
+    void evaluate (const std::vector<T>& objects, std::vector<float>& values) const;
+
+    // Evaluate the expression for each of the objects in 'objects' at the positions 'indices', storing the results in 'values' (in the order of 'indices').
+    void evaluate (const std::vector<T>& objects, const std::vector<unsigned>& indices, std::vector<float>& values) const;
+
+
+  private:
+
+    /// Low-level management method(s).
+    // Parsing.
+    void parseOr_      ();
+    void parseAnd_     ();
+    void parseCompare_ ();
+    void parseSum_     ();
+    void parseProduct_ ();
+    void parseUnary_   ();
+    void parsePrimary_ ();
+    void parseCall_    (const std::string& function);
+
+    // Lexing.
+    void        skipSpace_  ();
+    bool        accept_     (const std::string& token);
+    void        expect_     (const std::string& token);
+    bool        peekName_   () const;
+    std::string readName_   ();
+    std::string readString_ ();
+
+    // Code generation.
+    void     emit_     (const OpCode& op, const float& value = 0., const unsigned& index = 0);
+    unsigned nameIndex_ (const std::string& name);
+    bool     variable_ (const std::string& name);
+
+    // Evaluation; the loads are specialised for each object type.
+    float load_ (const T& obj, const Instruction& instruction) const;
+
+    // Keys for 'm_names' in 'schema', looked up (without registering the names) if not already done.
+    std::vector<InfoKey>& keys_ (const InfoSchema* schema) const;
+
+    // Column-wise evaluation of 'N' objects, with the i'th object given by 'at(i)'.
+    template<class A>
+    void evaluateColumns_ (const unsigned& N, const A& at, std::vector<float>& values) const;
+
+
+  private:
+
+    /// Data member(s).
+    std::string m_expression;
+    std::size_t m_pos = 0;
+
+    std::vector<Instruction> m_instructions;
+    std::vector<std::string> m_names;
+    unsigned m_size  = 0; // Current stack size, while parsing.
+    unsigned m_depth = 0; // Maximal stack size.
+
+    // Scratch space, sized once when parsing.
+    mutable std::vector<float> m_stack;
+    mutable std::vector< std::vector<float> > m_columns;
+
+    // Keys for 'm_names' (see 'resolve'), for each schema seen so far. Names not in a schema have keys without a schema.
+    struct SchemaKeys {
+      const InfoSchema*    schema;
+      std::vector<InfoKey> keys;
+    };
+    mutable std::vector<SchemaKeys> m_keys;
+    mutable unsigned m_lastKeys = 0; // Entry in 'm_keys' used last.
+
+  };
+
+} // namespace
+
+#endif // AnalysisTools_Expression_h
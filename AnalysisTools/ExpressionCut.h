@@ -0,0 +1,113 @@
+#ifndef AnalysisTools_ExpressionCut_h
+#define AnalysisTools_ExpressionCut_h
+
+/**
+ * @file ExpressionCut.h
+ * @author Andreas Sogaard
+ **/
+
+// STL include(s).
+#include <string>
+#include <vector>
+#include <memory> /* std::shared_ptr */
+#include <functional> /* std::function */
+
+// AnalysisTools include(s).
+#include "AnalysisTools/Cut.h"
+#include "AnalysisTools/Expression.h"
+
+using namespace std;
+
+namespace AnalysisTools {
+
+    /**
+     * Cut defined by a string expression, e.g.
+     *   Cut<PhysicsObject>::fromExpression("pt > 200 && abs(eta) < 2 && info(rhoDDT) > 1.5")
+     *
+     * The expression is parsed once, on construction. When applied to a whole collection of candidates, the expression is evaluated column-wise over all candidates before the per-candidate bookkeeping (plots, trees) is done. See Expression<T> for the supported syntax.
+     */
+    template <class T>
+    class ExpressionCut : public Cut<T> {
+
+    public:
+
+        // Constructor(s).
+        ExpressionCut (const string& name, const string& expression) :
+	    Cut<T>(name),
+	    m_expression(new Expression<T>(expression))
+	{
+	  bindFunction_();
+	};
+
+	ExpressionCut (const ExpressionCut<T>& other) :
+	    Cut<T>(other),
+	    m_expression(new Expression<T>(*other.m_expression)) // Each copy gets its own scratch space.
+	{
+	  bindFunction_();
+	};
+
+        // Destructor(s).
+        ~ExpressionCut () {};
+
+
+    public:
+
+        // Set method(s).
+	inline ExpressionCut<T> withRange (const float& down, const float& up) {
+	    ExpressionCut<T> output(*this);
+	    output.clearRanges();
+	    output.addRange(down, up);
+	    return output;
+	}
+
+	inline ExpressionCut<T> withRange (const float& value) {
+	    ExpressionCut<T> output(*this);
+	    output.clearRanges();
+	    output.addRange(value);
+	    return output;
+	}
+
+	// Resolve the info names in the expression against 'schema', e.g. that of the CollectionRetriever providing the objects, rather than on first use.
+	inline void setSchema (InfoSchema* schema) { m_expression->resolve(schema); }
+
+	// Get method(s).
+	inline const Expression<T>& expression () const { return *m_expression; }
+
+        // High-level management method(s).
+        virtual bool apply (const T& obj, const float& w = 1) {
+	    const Expression<T>* expression = m_expression.get();
+	    return this->apply_(obj, w, [expression](const T& o) { return expression->evaluate(o); });
+	}
+
+        virtual void apply (const vector<T>& objects, vector<unsigned>& indices, const float& w = 1) {
+	    // Evaluate all surviving candidates at once, then do the bookkeeping for each.
+	    m_expression->evaluate(objects, indices, m_values);
+	    this->applyColumn_(objects, indices, w, m_values);
+	    return;
+	}
+
+	virtual Cut<T>* clone () const {
+	    return new ExpressionCut<T>(*this);
+	}
+
+
+    private:
+
+	// Point the std::function (used for plotting and caching) at this instance's expression.
+	inline void bindFunction_ () {
+	    const std::shared_ptr< Expression<T> > expression = m_expression;
+	    this->m_function = [expression](const T& o) { return expression->evaluate(o); };
+	    return;
+	}
+
+
+    private:
+
+	std::shared_ptr< Expression<T> > m_expression;
+	std::vector<float> m_values;
+
+    };
+
+}
+
+#endif
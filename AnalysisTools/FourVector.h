@@ -0,0 +1,121 @@
+#ifndef AnalysisTools_FourVector_h
+#define AnalysisTools_FourVector_h
+
+/**
+ * @file   FourVector.h
+ * @author Andreas Sogaard
+ * @brief  Compact four-vector, used as the kinematic part of PhysicsObject.
+ */
+
+// STL include(s).
+#include <cmath> /* std::sqrt, std::cos, ... */
+#include <algorithm> /* std::max */
+
+// ROOT include(s).
+#include "TLorentzVector.h"
+
+namespace AnalysisTools {
+
+  /**
+   * Four-vector stored as single-precision (pt, eta, phi, m), i.e. the variables most analyses cut on, which are therefore read directly rather than recomputed. The Cartesian components (px, py, pz, E) are derived from these on demand, in double precision.
+   *
+   * The class is trivially copyable and 16 bytes in size (compared to 64 bytes, a vtable and a TObject header for TLorentzVector), such that collections of FourVectors are contiguous and can be copied with memcpy. This does not extend to PhysicsObject, which also holds its auxiliary information in std::vectors. The method names follow those of TLorentzVector, and conversion to and from TLorentzVector is provided for input and output. Vectors along the beam axis, which have zero pt and infinite eta, are instead stored with a negligible pt of 2^-64 |pz| and the corresponding finite eta, such that their longitudinal momentum is kept (to a relative precision of about 10^-6), and sums involving them stay finite. Since the stored variables are rounded to single precision, a cut on a value within float rounding of its boundary may decide differently than for a TLorentzVector.
+   */
+  class FourVector {
+
+  public:
+
+    /// Constructor(s).
+    FourVector () {};
+    FourVector (const float& pt, const float& eta, const float& phi, const float& m) :
+      m_pt(pt), m_eta(eta), m_phi(phi), m_m(m)
+    {};
+    FourVector (const TLorentzVector& other);
+
+
+  public:
+
+    /// Set method(s).
+    void SetPtEtaPhiM (const double& pt, const double& eta, const double& phi, const double& m);
+    void SetPtEtaPhiE (const double& pt, const double& eta, const double& phi, const double& e);
+    void SetPxPyPzE   (const double& px, const double& py, const double& pz, const double& e);
+    void SetXYZT      (const double& x,  const double& y,  const double& z,  const double& t) { SetPxPyPzE(x, y, z, t); }
+    void SetXYZM      (const double& x,  const double& y,  const double& z,  const double& m);
+
+
+    /// Get method(s).
+    inline double Pt   () const { return m_pt;  }
+    inline double Eta  () const { return m_eta; }
+    inline double Phi  () const { return m_phi; }
+    inline double M    () const { return m_m;   }
+
+    inline double Perp () const { return Pt(); }
+    inline double PseudoRapidity () const { return Eta(); }
+    inline double Mag  () const { return M(); }
+    inline double M2   () const { return m_m < 0 ? -(double) m_m * m_m : (double) m_m * m_m; }
+
+    inline double Px   () const { return m_pt * std::cos((double) m_phi); }
+    inline double Py   () const { return m_pt * std::sin((double) m_phi); }
+    inline double Pz   () const { return m_pt == 0 ? 0. : m_pt * std::sinh((double) m_eta); }
+    inline double P    () const { return m_pt == 0 ? 0. : m_pt * std::cosh((double) m_eta); }
+    inline double E    () const;
+
+    inline double X    () const { return Px(); }
+    inline double Y    () const { return Py(); }
+    inline double Z    () const { return Pz(); }
+    inline double T    () const { return E();  }
+    inline double Energy () const { return E(); }
+
+    inline double Et   () const { const double p = P(); return p == 0 ? 0. : E() * Pt() / p; }
+    double Rapidity () const;
+
+    inline double DeltaPhi (const FourVector& other) const;
+    inline double DeltaR   (const FourVector& other) const;
+
+    // Conversion to ROOT type, e.g. for output.
+    TLorentzVector lorentzVector () const;
+    inline operator TLorentzVector () const { return lorentzVector(); }
+
+
+    /// Operator(s).
+    FourVector  operator+  (const FourVector& other) const;
+    FourVector& operator+= (const FourVector& other);
+    FourVector  operator-  (const FourVector& other) const;
+    FourVector& operator-= (const FourVector& other);
+    FourVector& operator*= (const double& a);
+
+
+  private:
+
+    /// Data member(s).
+    float m_pt  = 0;
+    float m_eta = 0;
+    float m_phi = 0;
+    float m_m   = 0;
+
+  };
+
+
+  // Inline get method(s).
+  inline double FourVector::E () const {
+    const double p = P();
+    // Same convention as TLorentzVector for space-like vectors, which are stored with negative mass.
+    return (m_m >= 0 ? std::sqrt(p * p + (double) m_m * m_m) : std::sqrt(std::max(p * p - (double) m_m * m_m, 0.)));
+  }
+
+  inline double FourVector::DeltaPhi (const FourVector& other) const {
+    double dphi = (double) m_phi - other.m_phi;
+    while (dphi >=  M_PI) { dphi -= 2. * M_PI; }
+    while (dphi <  -M_PI) { dphi += 2. * M_PI; }
+    return dphi;
+  }
+
+  inline double FourVector::DeltaR (const FourVector& other) const {
+    const double deta = (double) m_eta - other.m_eta;
+    const double dphi = DeltaPhi(other);
+    return std::sqrt(deta * deta + dphi * dphi);
+  }
+
+} // namespace
+
+#endif // AnalysisTools_FourVector_h
@@ -19,6 +19,7 @@
 // AnalysisTools include(s).
 #include "AnalysisTools/Utilities.h"
 #include "AnalysisTools/Range.h"
+#include "AnalysisTools/RangeSet.h"
 
 using namespace std;
 
@@ -55,7 +56,7 @@ namespace AnalysisTools {
     private:
     
         bool m_hasXML = false;
-        map< int, Ranges > m_goodRuns;
+        map< int, RangeSet > m_goodRuns;
         
     };
 
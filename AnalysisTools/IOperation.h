@@ -21,7 +21,10 @@
 #include "TTree.h"
 
 // Forward declaration(s).
-// ...
+namespace  AnalysisTools {
+    template <class T, class U>
+    class Selection;
+}
 
 // AnalysisTools include(s).
 #include "AnalysisTools/IPlotMacro.h"
@@ -40,6 +43,8 @@ namespace AnalysisTools {
     class IOperation : virtual public ILocalised {
                 
         friend class ISelection;
+        template <class T, class U>
+        friend class Selection;
         
     public:
 
@@ -60,6 +65,11 @@ namespace AnalysisTools {
         // Get method(s).
         // ...
 	inline const OperationType& operationType () const { return m_operationType; }
+
+	/**
+	 * Identifier shared by the copies of an operation added to several categories of a selection at once, and 0 otherwise. It is reset if a copy is modified afterwards, e.g. its ranges or function. Used to check that the categories run the same operations before their branch point (see EventSelection).
+	 */
+	inline const unsigned& origin () const { return m_origin; }
         
         
         // High-level management method(s).
@@ -91,6 +101,8 @@ namespace AnalysisTools {
         bool m_initialised = false;
 
 	OperationType m_operationType = OperationType::Interface;
+
+	unsigned m_origin = 0;
         
     };
     
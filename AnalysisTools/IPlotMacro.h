@@ -48,7 +48,7 @@ namespace AnalysisTools {
 
         
         // Get method(s).
-        // ...
+	inline const double& value () const { return m_value; }
         
         
         // High-level management method(s).
@@ -24,6 +24,7 @@
 #include "AnalysisTools/IOperation.h"
 #include "AnalysisTools/Localised.h"
 #include "AnalysisTools/ValuesCache.h"
+#include "AnalysisTools/TreeBuffer.h"
 
 using namespace std;
 
@@ -68,6 +69,37 @@ namespace AnalysisTools {
 
 	virtual bool passes (const std::string& category) const {};
 
+	/**
+	 * Whether the selection is run on demand, rather than by the parent analysis (see ObjectDefinition::setLazy). If so, the parent analysis only calls 'invalidate' for each new event.
+	 */
+	virtual bool lazy       () const { return false; }
+	virtual void invalidate ()       {}
+
+	/**
+	 * Whether this selection may be run concurrently with others, whether it depends on the output of 'other', and whether running it can stop the analysis pipeline. Used for deciding which selections can be run concurrently (see Analysis::setConcurrency). Conservatively false, true and true, respectively, unless specified by derived classes.
+	 */
+	virtual bool concurrent () const                { return false; }
+	virtual bool dependsOn  (ISelection* /*other*/) { return true; }
+	virtual bool canFail    () const                { return true; }
+
+	/**
+	 * Batch mode (see Analysis::runBuffered). Selections supporting it can buffer the current event, to be run later together with the other buffered events by 'runBatch'. Once run, 'batchResult' gives whether the buffered event with the given index passed, as 'run' would have returned.
+	 */
+	virtual bool     batchable   () const { return false; }
+	virtual void     buffer      ()       {}
+	virtual unsigned buffered    () const { return 0; }
+	virtual bool     runBatch    ()       { return false; }
+	virtual bool     batchResult (const unsigned& /*index*/) const { return false; }
+
+	/**
+	 * Output trees filled while the selection is run concurrently (see Analysis::setConcurrency). The operations of the selection add their rows to their own buffers, registered with 'defer' once non-empty, and the parent analysis writes them using 'writeDeferred' after all selections have been run.
+	 */
+	inline void defer (TreeBuffer* buffer) { m_deferred.push_back(buffer); }
+	inline void writeDeferred () {
+	  for (TreeBuffer* buffer : m_deferred) { buffer->write(); }
+	  m_deferred.clear();
+	}
+
 	virtual void print () const = 0;
         
     protected:
@@ -98,6 +130,8 @@ namespace AnalysisTools {
 	ValuesCache m_valuesCache;
 	bool m_performCaching = false;
 
+	std::vector< TreeBuffer* > m_deferred;
+
     };
     
     //using SelectionsPtr = std::vector< std::unique_ptr<ISelection> >;
@@ -0,0 +1,102 @@
+#ifndef AnalysisTools_InfoColumns_h
+#define AnalysisTools_InfoColumns_h
+
+/**
+ * @file   InfoColumns.h
+ * @author Andreas Sogaard
+ * @brief  Typed per-object columns of auxiliary information, read in place by PhysicsObjects.
+ */
+
+// STL include(s).
+#include <vector> /* std::vector */
+#include <cassert> /* assert */
+
+// AnalysisTools include(s).
+#include "AnalysisTools/InfoSchema.h"
+
+namespace AnalysisTools {
+
+  /**
+   * Set of columns of auxiliary information, i.e. vectors holding one value per object in a collection, bound by the slots of a schema.
+   *
+   * The columns are not copied; values are read from the bound vectors, at their native type, only once they are accessed. A PhysicsObject referring to the columns (see PhysicsObject::setColumns) therefore carries no copy of its auxiliary information, only its index in the collection. The bound vectors must outlive the columns, and their contents are those of the current event.
+   */
+  class InfoColumns {
+
+  public:
+
+    /// Constructor(s).
+    InfoColumns (InfoSchema* schema = InfoSchema::global()) :
+      m_schema(schema)
+    {};
+
+
+  public:
+
+    /// Set method(s).
+    // Bind the vector at 'address' to the slot of 'key'. Supported types are double, float, bool and int.
+    template <class T>
+    void bind (const InfoKey& key, const std::vector<T>* address);
+
+    void clear ();
+
+
+    /// Get method(s).
+    inline InfoSchema* schema () const { return m_schema; }
+
+    // Number of bound columns.
+    inline unsigned size () const { return m_size; }
+
+    inline bool   has   (const InfoKey& key) const;
+    inline double value (const InfoKey& key, const unsigned& index) const;
+
+
+  private:
+
+    /// Type of a bound column.
+    enum ColumnType : unsigned char { None = 0, Double, Float, Bool, Int };
+
+    struct Column {
+      const void* address = nullptr;
+      ColumnType  type    = None;
+    };
+
+    // Value at 'index' in the vector of type T at 'address'.
+    template <class T>
+    static inline double at_ (const void* address, const unsigned& index) {
+      const std::vector<T>& column = *static_cast<const std::vector<T>*>(address);
+      assert( index < column.size() );
+      return column[index];
+    }
+
+
+  private:
+
+    /// Data member(s).
+    InfoSchema*         m_schema;
+    std::vector<Column> m_columns; // Indexed by slot.
+    unsigned            m_size = 0;
+
+  };
+
+
+  // Inline get method(s).
+  inline bool InfoColumns::has (const InfoKey& key) const {
+    return key.schema == m_schema && key.slot < m_columns.size() && m_columns[key.slot].type != None;
+  }
+
+  inline double InfoColumns::value (const InfoKey& key, const unsigned& index) const {
+    assert( has(key) );
+    const Column& column = m_columns[key.slot];
+    switch (column.type) {
+    case Double: return at_<double>(column.address, index);
+    case Float:  return at_<float> (column.address, index);
+    case Bool:   return at_<bool>  (column.address, index);
+    case Int:    return at_<int>   (column.address, index);
+    default:     return 0;
+    }
+  }
+
+} // namespace
+
+#endif // AnalysisTools_InfoColumns_h
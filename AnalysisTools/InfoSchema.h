@@ -0,0 +1,92 @@
+#ifndef AnalysisTools_InfoSchema_h
+#define AnalysisTools_InfoSchema_h
+
+/**
+ * @file   InfoSchema.h
+ * @author Andreas Sogaard
+ * @brief  Registry mapping the names of auxiliary information on PhysicsObjects to dense slot indices.
+ */
+
+// STL include(s).
+#include <string> /* std::string */
+#include <vector> /* std::vector */
+#include <unordered_map> /* std::unordered_map */
+#include <memory> /* std::unique_ptr */
+#include <atomic> /* std::atomic */
+#include <mutex> /* std::mutex, std::lock_guard */
+
+namespace AnalysisTools {
+
+  // Forward declaration(s).
+  class InfoSchema;
+
+  /**
+   * Handle to an auxiliary information variable in a given schema. Obtained once, by name, from the schema (see InfoSchema::key), after which PhysicsObject::info(key) is a plain array access for all objects using that schema.
+   */
+  struct InfoKey {
+    const InfoSchema* schema = nullptr;
+    unsigned          slot   = 0;
+  };
+
+
+  /**
+   * Set of auxiliary information names used by a collection of PhysicsObjects, each assigned a fixed slot in the flat array of values stored on the objects.
+   *
+   * Each CollectionRetriever holds a schema, which is shared by all objects it creates, and by all copies of these. Objects not created by a retriever use a global default schema (see InfoSchema::global). Schemas must outlive the objects using them.
+   *
+   * Names are only ever added, never removed, so slots and keys stay valid for the lifetime of the schema. Registering names is thread-safe, and serialised; looking up names already registered (see 'find', 'name' and 'size') neither locks nor modifies the schema, since the table of names is copied on write, and the previous copies are kept until the schema is destroyed. Accessing values by key doesn't touch the schema at all.
+   */
+  class InfoSchema {
+
+  public:
+
+    /// Constructor(s).
+    InfoSchema () {
+      m_tables.emplace_back(new Table());
+      m_table.store(m_tables.back().get());
+    };
+
+    // Schemas are referred to by address, and so can't be copied.
+    InfoSchema (const InfoSchema& other) = delete;
+    InfoSchema& operator= (const InfoSchema& other) = delete;
+
+
+  public:
+
+    /// Get method(s).
+    // Key for 'name', which is registered if not already in the schema.
+    InfoKey key (const std::string& name);
+
+    // Look up the key for 'name', without registering it. Returns whether 'name' is in the schema; if not, 'key' is left unchanged.
+    bool find (const std::string& name, InfoKey& key) const;
+
+    // Name of the variable in 'slot'.
+    std::string name (const unsigned& slot) const;
+
+    // Number of registered variables.
+    unsigned size () const;
+
+    // Schema used by PhysicsObjects not created by a CollectionRetriever.
+    static InfoSchema* global ();
+
+
+  private:
+
+    /// Data type(s).
+    struct Table {
+      std::unordered_map<std::string, unsigned> slots;
+      std::vector<std::string>                  names;
+    };
+
+
+    /// Data member(s).
+    std::mutex m_mutex; // Serialises registration.
+
+    std::atomic<const Table*>                   m_table { nullptr }; // Current table, read without locking.
+    std::vector< std::unique_ptr<const Table> > m_tables; // All versions of the table, since readers may still hold an older one.
+
+  };
+
+} // namespace
+
+#endif // AnalysisTools_InfoSchema_h
@@ -0,0 +1,43 @@
+#ifndef AnalysisTools_Kernels_h
+#define AnalysisTools_Kernels_h
+
+/**
+ * @file   Kernels.h
+ * @author Andreas Sogaard
+ * @brief  Column-wise kernels for common object-level cuts.
+ */
+
+// STL include(s).
+#include <string> /* std::string */
+#include <vector> /* std::vector */
+
+// AnalysisTools include(s).
+#include "AnalysisTools/PhysicsObject.h"
+#include "AnalysisTools/RangeSet.h"
+
+namespace AnalysisTools {
+
+  /**
+   * Kernels computing a cut variable for a whole collection of candidates at once, and testing the resulting column of values against a set of ranges.
+   *
+   * The cut variables are stored directly on the objects (see FourVector), so the variable kernels only gather them into a contiguous column. The range test has a vectorised (AVX2) and a scalar implementation, which both give bit-identical results to evaluating the cut one object at a time, since they use the same (ordered) comparisons as RangeSet::contains.
+   *
+   * The vectorised implementation is used if the CPU supports AVX2 and it hasn't been switched off using 'setVectorisedKernels(false)'.
+   */
+
+  // Runtime switch.
+  void setVectorisedKernels (const bool& use);
+  bool vectorisedKernels ();
+
+  // Compute cut variables for the objects in 'objects' at positions 'indices', storing the results in 'values' (in the order of 'indices').
+  void kernelPt   (const PhysicsObjects& objects, const std::vector<unsigned>& indices, std::vector<float>& values);
+  void kernelEta  (const PhysicsObjects& objects, const std::vector<unsigned>& indices, std::vector<float>& values);
+  void kernelM    (const PhysicsObjects& objects, const std::vector<unsigned>& indices, std::vector<float>& values);
+  void kernelInfo (const PhysicsObjects& objects, const std::vector<unsigned>& indices, const std::string& name, const float& scale, std::vector<float>& values);
+
+  // Test each value against 'ranges', as in Cut<T>: a value passes if it is contained in the set, or, if there are no ranges, if it is non-zero. The result is stored in 'mask' as 1 (pass) or 0 (fail).
+  void kernelRanges (const std::vector<float>& values, const RangeSet& ranges, std::vector<unsigned char>& mask);
+
+} // namespace
+
+#endif // AnalysisTools_Kernels_h
@@ -12,12 +12,17 @@
 #include <map>
 #include <assert.h>
 #include <memory> /* shared_ptr */
+#include <numeric> /* std::iota */
+#include <algorithm> /* std::remove, std::count_if */
+#include <limits> /* std::numeric_limits */
+#include <functional> /* std::function */
 
 // ROOT include(s).
 // ..
 
 // AnalysisTools include(s).
 #include "AnalysisTools/PhysicsObject.h"
+#include "AnalysisTools/InfoColumns.h"
 #include "AnalysisTools/Selection.h"
 #include "AnalysisTools/Cut.h"
 #include "AnalysisTools/Info.h"
@@ -44,6 +49,17 @@ namespace AnalysisTools {
         
         // Set method(s).
         void setInput  (const vector<T>* candidates);
+
+	/**
+	 * Require the number of selected candidates to be in [min, max] for the selection to be passed. If it isn't, in any category, 'run' returns false, such that a parent analysis can stop early if this object definition is required (see Selection::setRequired).
+	 */
+	void setRequiredMultiplicity (const unsigned& min, const unsigned& max = std::numeric_limits<unsigned>::max());
+
+	/**
+	 * Run the object definition on demand, i.e. only once its results are first accessed in an event, instead of for every event. The results are accessed through a collection linked to an EventSelection (see EventSelection::addCollection), or by a later object definition in the same analysis taking them as input (see setInput). Results are memoised for the rest of the event, and are empty until then, rather than those of the last event in which they were accessed. Since a lazy object definition isn't run by the parent analysis, it cannot stop the analysis pipeline, and its cutflow only counts the events in which it was accessed.
+	 */
+	inline void setLazy (const bool& lazy = true) { assert( !this->locked() ); m_lazy = lazy; }
+
         
         // High-level management method(s).
         virtual bool run ();
@@ -51,6 +67,20 @@ namespace AnalysisTools {
         PhysicsObjects* const result ();
         PhysicsObjects* const result (const string& category);
 
+	// Run, unless already run for the current event, and return the result.
+	PhysicsObjects* const demand (const string& category);
+
+	virtual inline bool lazy       () const { return m_lazy; }
+	virtual void        invalidate ();
+
+	virtual bool        dependsOn  (ISelection* other);
+	virtual inline bool canFail    () const { return m_minMultiplicity > 0 || m_maxMultiplicity < std::numeric_limits<unsigned>::max(); }
+
+	virtual inline bool passes (const std::string& category) const {
+	  assert( this->hasCategory(category) );
+	  return m_passes.at(category);
+	}
+
 	virtual void print () const;
      
         
@@ -58,14 +88,47 @@ namespace AnalysisTools {
         
         // Low-level management method(s).
         // ...
-	void prepareCandidates_ ();
+	/**
+	 * Set up the pool of PhysicsObject candidates for the current event, shared (read-only) by all categories.
+	 */
+	const PhysicsObjects* preparePool_ ();
+
+	/**
+	 * Bind the info containers of type U as columns, read in place by the candidates.
+	 */
+	template <class U>
+	void bindColumns_ ();
+
+	/**
+	 * Copy the candidates in 'pool' at positions 'survivors' to 'candidates', and make 'survivors' refer to the copies.
+	 */
+	void materialise_ (const PhysicsObjects& pool, vector<unsigned>& survivors, PhysicsObjects& candidates);
+
+	/**
+	 * Find the lazy object definition, if any, preceding this one in the parent analysis and producing its input, such that it can be run on demand (see setLazy).
+	 */
+	void findUpstream_ ();
         
         
     private:
 
+        PhysicsObjects m_pool; /* Candidates shared by all categories, if they cannot be taken directly from the input. */
+        InfoColumns m_columns; /* Info containers, bound as columns of the candidates in 'm_pool'. */
         map<string, PhysicsObjects> m_candidates;
+        map<string, vector<unsigned> > m_survivors; /* Indices of the candidates surviving the selection so far. */
+        
+        map<string, bool> m_passes;
         
         bool m_hasRun = false;
+
+        bool m_lazy    = false;
+        bool m_current = false; /* Whether 'run' has been called for the current event. */
+
+        std::function<void()> m_upstream; /* Runs the lazy object definition producing the input, if any. */
+        bool m_hasFoundUpstream = false;
+
+        unsigned m_minMultiplicity = 0;
+        unsigned m_maxMultiplicity = std::numeric_limits<unsigned>::max();
         
         const vector<T>* m_input = nullptr; /* Universal; not category-specific. */
         
@@ -33,7 +33,9 @@ namespace  AnalysisTools {
 #include "AnalysisTools/PhysicsObject.h"
 #include "AnalysisTools/Event.h"
 #include "AnalysisTools/Range.h"
+#include "AnalysisTools/RangeSet.h"
 #include "AnalysisTools/PlotMacro1D.h"
+#include "AnalysisTools/ExecutionPlan.h"
 
 using namespace std;
 
@@ -113,17 +115,25 @@ namespace AnalysisTools {
         // High-level management method(s).
         bool apply (T& obj, const float& w = 1.);
 
+        /**
+         * Fill the plots at 'pos' of the operation as if it had been applied to 'obj', with outcome 'passes', and for 'CutPosition::Post' also its trees. 'obj' is the object before the operation for the pre-operation plots, and after it for the post-operation ones. Used for operations shared by several categories, which are only run in one of them (see EventSelection).
+         */
+        void replay (const CutPosition& pos, const T& obj, const float& w, const bool& passes = true);
+
         
     protected:
         
         // Low-level management method(s).
-        void init  ();
+        void init     ();
+        void compile_ ();
 
         
     private:
         
 	std::function< float(T&) > m_function;
-        Ranges m_ranges;
+        RangeSet m_ranges;
+
+        ExecutionPlan<T> m_plan;
         
         string m_variable = "";
         string m_unit     = "";
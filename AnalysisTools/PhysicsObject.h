@@ -19,6 +19,10 @@
 
 // AnalysisTools include(s).
 #include "AnalysisTools/Utilities.h"
+#include "AnalysisTools/InfoSchema.h"
+#include "AnalysisTools/InfoColumns.h"
+#include "AnalysisTools/FourVector.h"
+#include "AnalysisTools/EventArena.h"
 
 /*
  * Make templated? Derive from same base class as Event? (Both have 'info' member and related methods.)
@@ -28,14 +32,20 @@ using namespace std;
 
 namespace AnalysisTools {
 
-    class PhysicsObject : public TLorentzVector {
+    /**
+     * Physics object: a four-vector, with auxiliary information attached. The kinematics are those of FourVector, i.e. the Cartesian components are computed on demand rather than stored, to keep objects small.
+     */
+    class PhysicsObject : public FourVector {
         
     public:
 
         // Constructor(s).
         PhysicsObject () {};
+        PhysicsObject (const FourVector& other) :
+            FourVector(other)
+        {};
         PhysicsObject (const TLorentzVector& other) :
-            TLorentzVector(other)
+            FourVector(other)
         {};
         
         // Destructor(s).
@@ -43,12 +53,25 @@ namespace AnalysisTools {
         
         
     public:
-        
+
         // Set method(s).
         void addInfo (const string& name, const double& val);
+        void addInfo (const InfoKey& key, const double& val);
+
+        // Set the schema of the (so far empty) auxiliary information. Objects in the same collection should share one.
+        void setSchema (InfoSchema* schema);
+
+        // Read auxiliary information not added to the object itself from position 'index' in 'columns', which also sets the schema. The object (and its copies) must not be read once the columns have moved on to another event, unless detached first.
+        void setColumns (const InfoColumns* columns, const unsigned& index);
+
+        // Copy the values read from the columns, if any, into the object itself, and move its info from the event arena to the heap, if drawn from it, such that the object stays valid beyond the current event.
+        void detach ();
         
         // Get method(s).
         double info (const string& name) const;
+        inline double info (const InfoKey& key) const;
+
+        inline InfoSchema* schema () const { return m_schema; }
         
         
         // High-level management method(s).
@@ -56,11 +79,34 @@ namespace AnalysisTools {
         
         
     private:
+
+        // Low-level management method(s).
+        double infoSlow_ (const InfoKey& key) const;
         
-        map<string, double> m_info;
+        
+    private:
+
+        // Auxiliary information, indexed by the slots in 'm_schema'. Drawn from the event arena, if switched on (see EventArena).
+        InfoSchema* m_schema = InfoSchema::global();
+        vector<double, ArenaAllocator<double> > m_values;
+        vector<bool,   ArenaAllocator<bool> >   m_present;
+
+        // Columns of auxiliary information, if any, and the position of this object in them.
+        const InfoColumns* m_columns = nullptr;
+        unsigned           m_index   = 0;
         
     };
 
+
+    // Inline get method(s).
+    inline double PhysicsObject::info (const InfoKey& key) const {
+        if (key.schema == m_schema) {
+            if (key.slot < m_present.size() && m_present[key.slot]) { return m_values[key.slot]; }
+            if (m_columns && m_columns->has(key)) { return m_columns->value(key, m_index); }
+        }
+        return infoSlow_(key);
+    }
+
     using PhysicsObjects    = std::vector<PhysicsObject>;
     using PhysicsObjectPtrs = std::vector<const PhysicsObject*>;
     
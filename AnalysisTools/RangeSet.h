@@ -0,0 +1,99 @@
+#ifndef AnalysisTools_RangeSet_h
+#define AnalysisTools_RangeSet_h
+
+/**
+ * @file RangeSet.h
+ * @author Andreas Sogaard
+ */
+
+// STL include(s).
+#include <vector>
+#include <algorithm> /* std::upper_bound */
+#include <cassert> /* assert */
+
+// AnalysisTools include(s).
+#include "AnalysisTools/Range.h"
+
+namespace AnalysisTools {
+
+    /**
+     * Union of a number of (inclusive) ranges, compiled into sorted, disjoint intervals for fast membership tests.
+     *
+     * A value is contained in the set iff it is contained in any of the ranges added, as per Range::contains; in particular, NaN is never contained. For a few intervals, membership is tested against all of them without branching; for many, the interval is found by binary search.
+     */
+    class RangeSet {
+
+    public:
+
+        // Constructor(s).
+        RangeSet () {};
+        RangeSet (const Ranges& ranges);
+
+        // Destructor(s).
+        ~RangeSet () {};
+
+
+    public:
+
+        // Set method(s).
+        void clear ();
+        void add (const Range&  range);
+        void add (const Ranges& ranges);
+
+
+        // Get method(s).
+        inline unsigned size  () const { return m_down.size(); }
+        inline bool     empty () const { return m_down.empty(); }
+
+        // Limits of the i'th interval, in increasing order.
+        inline const float& down (const unsigned& i) const { return m_down[i]; }
+        inline const float& up   (const unsigned& i) const { return m_up[i]; }
+
+        Ranges ranges () const;
+
+
+        // High-level management method(s).
+        inline bool contains (const float& val) const;
+
+        // Test each of the 'N' values in 'values', storing the results in 'mask' as 1 (contained) or 0 (not contained).
+        void contains (const float* values, const unsigned& N, unsigned char* mask) const;
+
+
+    public:
+
+        // Largest number of intervals tested without binary search.
+        static const unsigned s_maxBranchless = 4;
+
+
+    private:
+
+        // Low-level management method(s).
+        void normalise_ ();
+
+
+    private:
+
+        std::vector<float> m_down;
+        std::vector<float> m_up;
+
+    };
+
+
+    // Inline high-level management method(s).
+    inline bool RangeSet::contains (const float& val) const {
+        const unsigned N = m_down.size();
+        if (N <= s_maxBranchless) {
+            bool passes = false;
+            for (unsigned i = 0; i < N; i++) {
+                passes |= (val >= m_down[i]) & (val <= m_up[i]);
+            }
+            return passes;
+        }
+        // Last interval starting at or below 'val'. NaN compares false, and so ends up either before the first interval or failing the upper limit test.
+        const unsigned i = std::upper_bound(m_down.begin(), m_down.end(), val) - m_down.begin();
+        return i > 0 && val >= m_down[i - 1] && val <= m_up[i - 1];
+    }
+
+}
+
+#endif
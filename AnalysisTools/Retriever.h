@@ -85,6 +85,12 @@ namespace AnalysisTools {
     // Template-parameter specific method for filling the container for the data being retrieved.
     virtual void fillCache_ () = 0;
 
+    // Attempt to read 'branch' directly, rather than through a TTreeFormula, in which case its formula is left empty. Called once for each branch, in order, when initialising. By default, all branches are read through formulas.
+    virtual bool bind_ (const std::string& /*branch*/) { return false; }
+
+    // Release any direct bindings made by 'bind_'.
+    virtual void unbind_ () {}
+
 
   protected:
     
@@ -104,7 +110,7 @@ namespace AnalysisTools {
     // Functions from which to construct additional auxiliary information.
     std::map<std::string, std::function< float(const T&) > > m_infoFunctions;
 
-    // TTreeFormulas for reading heterogenous data from TTrees 
+    // TTreeFormulas for reading heterogenous data from TTrees, one for each branch (empty if read directly, see 'bind_').
     std::vector< std::unique_ptr<TTreeFormula> > m_formulas;
 
     // Map for renaming branches.
@@ -15,6 +15,7 @@
 #include <utility> /* std::make_pair */
 #include <regex>
 #include <iterator> /* std::advance */
+#include <set>
 
 // ROOT include(s).
 #include "TDirectory.h"
@@ -29,6 +30,7 @@
 #include "AnalysisTools/Event.h"
 #include "AnalysisTools/Cut.h"
 #include "AnalysisTools/Operation.h"
+#include "AnalysisTools/CutScheduler.h"
 
 using namespace std;
 
@@ -65,6 +67,9 @@ namespace AnalysisTools {
 	  this->m_required = other.m_required;
 	  this->m_locked   = false;
 	  this->m_debug    = other.m_debug;
+	  this->m_warmup   = other.m_warmup;
+	  this->m_concurrent   = other.m_concurrent;
+	  this->m_dependencies = other.m_dependencies;
 
 	  addCategories(other.m_categories);
 	  for (const auto& category : m_categories) {
@@ -77,10 +82,16 @@ namespace AnalysisTools {
 		addOperation(*op, category, false);
 	      } else {
 		WARNING("Couldn't cast IOperation '%s'.", iop->name().c_str());
+		continue;
 	      }
+	      this->m_operations[category].back()->m_origin = iop->origin();
 	    }
 
 	  }
+
+	  // Keep the branch point, which is otherwise set by the first operation added to a single category, above.
+	  this->m_branch   = other.m_branch;
+	  this->m_nOrigins = other.m_nOrigins;
 	};
 
         // Destructor(s).
@@ -124,6 +135,17 @@ namespace AnalysisTools {
         void addOperation (const string& name, const function< double(U&) >& f, const string& category);
 
         void addPlot (const CutPosition& pos, const PlotMacro1D<U>& plot);
+
+	/**
+	 * Enable adaptive reordering of commutative cuts (see Cut::setCommutative and CutScheduler), based on the cost and rejection measured over the first 'warmup' events. A 'warmup' of 0 disables reordering. Only cuts without bookkeeping (see Cut::setBookkeeping) are reordered, such that the cutflow keeps its declared order.
+	 */
+	inline void setCutReordering (const unsigned& warmup = 1000) { assert( !locked() ); m_warmup = warmup; }
+
+	/**
+	 * Allow the selection to be run concurrently with the other selections in the parent analysis which it doesn't depend on, and which don't depend on it (see Analysis::setConcurrency). Only the collections passed between selections -- the input of an object definition (see ObjectDefinition::setInput), and the collections of an event selection (see EventSelection::addCollection) -- are known to the parent analysis, so dependencies on the results of other selections used otherwise, e.g. captured in the function of a cut, must be declared by name using 'addDependency'.
+	 */
+	inline void setConcurrent (const bool& concurrent = true) { assert( !locked() ); m_concurrent = concurrent; }
+	inline void addDependency (const string& name)             { assert( !locked() ); m_dependencies.insert(name); }
         
         
         // Get method(s).
@@ -143,6 +165,8 @@ namespace AnalysisTools {
 	
         bool hasRun ();
 
+	virtual inline bool concurrent () const { return m_concurrent; }
+
         
         // High-level management method(s).
         virtual bool run () = 0; /* No implementation. */
@@ -156,11 +180,23 @@ namespace AnalysisTools {
         void lockCategories   ();
         bool hasCutflow       (const string& category) const ;
         void setupCutflow     (const string& category);
+
+	CutScheduler* scheduler_ (const string& category, const unsigned& branch = 0);
        
         
     protected:
 
         int  m_branch = -1;
+
+        // Origin (see IOperation::origin) of the operation being added to all categories, if any, and the number of origins used so far.
+        unsigned m_origin   = 0;
+        unsigned m_nOrigins = 0;
+
+        unsigned m_warmup = 0;
+        map< string, CutScheduler > m_schedulers;
+
+        bool m_concurrent = false;
+        std::set<string> m_dependencies; /* Names of other selections on whose results this one depends, besides the collections it is given. */
         //bool m_hasRun = false;
 
         //const float* m_weight = nullptr;
@@ -0,0 +1,124 @@
+#ifndef AnalysisTools_StaticCut_h
+#define AnalysisTools_StaticCut_h
+
+/**
+ * @file StaticCut.h
+ * @author Andreas Sogaard
+ **/
+
+// STL include(s).
+#include <string>
+#include <vector>
+#include <functional> /* std::function */
+#include <utility> /* std::move, std::declval */
+#include <type_traits> /* std::true_type, std::false_type */
+
+// AnalysisTools include(s).
+#include "AnalysisTools/Cut.h"
+
+using namespace std;
+
+namespace AnalysisTools {
+
+    /**
+     * Cut which keeps the concrete type of the function computing the cut variable.
+     *
+     * Behaves exactly like Cut<T> -- and can be added to selections, plotted, copied, and cloned in the same way -- but the cut variable is computed by calling the functor directly rather than through std::function, such that it can be inlined (together with the range test) into the loop over candidates. If the functor additionally provides a column-wise method, 'column(objects, indices, values)', it is used to compute the cut variable for all candidates at once (see Kernels.h). The function is still stored as a std::function as well, for use by the pre- and post-cut plots and the values cache.
+     *
+     * Use 'makeStaticCut' to construct a StaticCut from a lambda:
+     *   auto cut = makeStaticCut<PhysicsObject>("pt", [](const PhysicsObject& p) { return p.Pt(); });
+     */
+    template <class T, class F>
+    class StaticCut : public Cut<T> {
+
+    public:
+
+        // Constructor(s).
+        StaticCut (const string& name, const F& f) :
+	    Cut<T>(name, function< float(const T&) >(f)),
+	    m_functor(f)
+	{};
+
+	StaticCut (const StaticCut<T,F>& other) :
+	    Cut<T>(other),
+	    m_functor(other.m_functor)
+	{};
+
+        // Destructor(s).
+        ~StaticCut () {};
+
+
+    public:
+
+        // Set method(s).
+	inline StaticCut<T,F> withRange (const float& down, const float& up) {
+	    StaticCut<T,F> output(*this);
+	    output.clearRanges();
+	    output.addRange(down, up);
+	    return output;
+	}
+
+	inline StaticCut<T,F> withRange (const float& value) {
+	    StaticCut<T,F> output(*this);
+	    output.clearRanges();
+	    output.addRange(value);
+	    return output;
+	}
+
+	// Get method(s).
+	inline const F& functor () const { return m_functor; }
+
+        // High-level management method(s).
+        virtual bool apply (const T& obj, const float& w = 1) {
+	    return this->apply_(obj, w, m_functor);
+	}
+
+        virtual void apply (const vector<T>& objects, vector<unsigned>& indices, const float& w = 1) {
+	    applyBatch_(objects, indices, w, decltype(hasColumn<F>(0))());
+	    return;
+	}
+
+	virtual Cut<T>* clone () const {
+	    return new StaticCut<T,F>(*this);
+	}
+
+
+    private:
+
+	// Detect whether the functor provides a column-wise kernel, i.e. a method 'column(objects, indices, values)'.
+	template <class G>
+	static auto hasColumn (int) -> decltype(std::declval<const G&>().column(std::declval< const vector<T>& >(), std::declval< const vector<unsigned>& >(), std::declval< vector<float>& >()), std::true_type());
+
+	template <class G>
+	static std::false_type hasColumn (...);
+
+	inline void applyBatch_ (const vector<T>& objects, vector<unsigned>& indices, const float& w, std::true_type) {
+	    m_functor.column(objects, indices, m_values);
+	    this->applyColumn_(objects, indices, w, m_values);
+	    return;
+	}
+
+	inline void applyBatch_ (const vector<T>& objects, vector<unsigned>& indices, const float& w, std::false_type) {
+	    this->apply_(objects, indices, w, m_functor);
+	    return;
+	}
+
+
+    private:
+
+	F m_functor;
+	vector<float> m_values;
+
+    };
+
+    /**
+     * Utility function for creating a StaticCut without having to spell out the functor type.
+     */
+    template <class T, class F>
+    inline StaticCut<T,F> makeStaticCut (const string& name, F f) {
+        return StaticCut<T,F>(name, std::move(f));
+    }
+
+}
+
+#endif
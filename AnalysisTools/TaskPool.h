@@ -0,0 +1,110 @@
+#ifndef AnalysisTools_TaskPool_h
+#define AnalysisTools_TaskPool_h
+
+/**
+ * @file TaskPool.h
+ * @author Andreas Sogaard
+ */
+
+// STL include(s).
+#include <vector>
+#include <functional> /* std::function */
+#include <thread> /* std::thread */
+#include <mutex> /* std::mutex, std::unique_lock */
+#include <condition_variable> /* std::condition_variable */
+#include <algorithm> /* std::min_element */
+
+// AnalysisTools include(s).
+#include "AnalysisTools/Logger.h"
+
+namespace AnalysisTools {
+
+  /**
+   * Fixed set of worker threads, used for running a batch of tasks concurrently, each once the tasks it depends on have finished.
+   */
+  class TaskPool {
+
+  public:
+
+    /// Constructor(s).
+    TaskPool (const unsigned& nThreads);
+
+    /// Destructor(s).
+    ~TaskPool ();
+
+
+  public:
+
+    /// Get method(s).
+    inline unsigned size () const { return m_workers.size() + 1; }
+
+    // Whether the calling thread is currently running a task.
+    static bool inTask ();
+
+
+    /// High-level management method(s).
+    // Run all 'tasks', using the calling thread as well as the workers, and return once they have all finished.
+    void run (const std::vector< std::function<void()> >& tasks);
+
+    // Run all 'tasks' as above, starting each only once the tasks at the positions in 'inputs' (all before its own) have finished. Of the tasks ready to start, the earliest is started first.
+    void run (const std::vector< std::function<void()> >& tasks, const std::vector< std::vector<unsigned> >& inputs);
+
+
+  private:
+
+    /// Low-level management method(s).
+    void work_    ();
+    void execute_ (std::unique_lock<std::mutex>& lock); // Executes ready tasks until all have finished. Called with 'm_mutex' locked.
+
+
+  private:
+
+    /// Data member(s).
+    std::vector<std::thread> m_workers;
+
+    std::mutex              m_mutex;
+    std::condition_variable m_start;
+    std::condition_variable m_progress; // Notified when a task finishes.
+    std::condition_variable m_done;
+
+    const std::vector< std::function<void()> >* m_tasks = nullptr;
+    std::vector<unsigned>                m_pending;    // Number of unfinished inputs of each task.
+    std::vector< std::vector<unsigned> > m_dependents; // Tasks taking each task as input.
+    std::vector<unsigned>                m_ready;      // Tasks with all inputs finished, not yet started.
+    unsigned m_finished   = 0;
+    unsigned m_active     = 0; // Number of workers currently executing tasks.
+    unsigned m_generation = 0;
+    bool     m_stop       = false;
+
+  };
+
+
+  /**
+   * Lock serialising access to shared ROOT state -- the current directory, and the directories of the output file in which histograms and trees are created -- while selections are being run concurrently. Does nothing unless concurrency has been switched on (see Analysis::setConcurrency). Only taken when setting up outputs, once per operation; rows filled by concurrent tasks are instead kept per operation, and written afterwards (see TreeBuffer).
+   */
+  class RootLock {
+
+  public:
+
+    RootLock () :
+      m_lock(mutex(), std::defer_lock)
+    {
+      if (s_concurrent) { m_lock.lock(); }
+    };
+
+    static inline void setConcurrent (const bool& concurrent) { s_concurrent = concurrent; }
+    static inline bool concurrent () { return s_concurrent; }
+
+  private:
+
+    static std::mutex& mutex ();
+
+    std::unique_lock<std::mutex> m_lock;
+
+    static bool s_concurrent;
+
+  };
+
+} // namespace
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef AnalysisTools_TreeBuffer_h
+#define AnalysisTools_TreeBuffer_h
+
+/**
+ * @file TreeBuffer.h
+ * @author Andreas Sogaard
+ */
+
+// STL include(s).
+#include <vector>
+#include <cassert> /* assert */
+
+// ROOT include(s).
+#include "TTree.h"
+
+// AnalysisTools include(s).
+#include "AnalysisTools/IPlotMacro.h"
+
+namespace AnalysisTools {
+
+  /**
+   * Rows of an output tree, kept in memory rather than filled into the tree directly.
+   *
+   * Used while selections are being run concurrently (see Analysis::setConcurrency): filling a tree may write to the output file shared by all selections, so each operation instead adds its rows to its own buffer, and the buffers are written to the trees in turn once all selections have been run (see ISelection::defer). The rows of each tree are thus written in the same order as if they had been filled directly.
+   */
+  class TreeBuffer {
+
+  public:
+
+    /// Set method(s).
+    // Buffer rows of 'tree', which has a branch for each of 'plots'.
+    void setTree (TTree* tree, const std::vector< IPlotMacro* >& plots);
+
+
+    /// Get method(s).
+    inline bool empty () const { return m_rows == 0; }
+
+
+    /// High-level management method(s).
+    // Add a row with the current values of the plots.
+    void add ();
+
+    // Fill the tree with all rows added since the last call, in order, and clear the buffer.
+    void write ();
+
+
+  private:
+
+    /// Data member(s).
+    TTree* m_tree = nullptr;
+    std::vector< IPlotMacro* > m_plots;
+    std::vector< double > m_values; // Values of the plots, row by row.
+    unsigned m_rows = 0;
+
+  };
+
+} // namespace
+
+#endif
@@ -46,6 +46,11 @@ namespace AnalysisTools {
       m_keys .clear();
       m_cache.clear();
     }
+
+    inline void swap (ValuesCache& other) {
+      m_keys .swap(other.m_keys);
+      m_cache.swap(other.m_cache);
+    }
     
   private:
     
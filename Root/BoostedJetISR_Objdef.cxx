@@ -19,6 +19,7 @@
 #include "AnalysisTools/Range.h"
 #include "AnalysisTools/GRL.h"
 #include "AnalysisTools/Cut.h"
+#include "AnalysisTools/EventArena.h"
 
 #include "AnalysisTools/Analysis.h"
 #include "AnalysisTools/ObjectDefinition.h"
@@ -361,22 +362,20 @@ int main (int argc, char* argv[]) {
     eventSelection.addCollection("LargeRadiusJets", "LargeRadiusJets");
 
     // * OPERATION: Choose lowest-tau21DDT et
-    eventSelection.addOperation("jetAmbiguity", [](Event& e) {
+    const ObjectInfo var_tau21DDT ("tau21DDT");
+    const InfoKey key_jets = Event::key("LargeRadiusJets");
+    const InfoKey key_jet  = Event::key("Jet");
+    eventSelection.addOperation("jetAmbiguity", [var_tau21DDT, key_jets, key_jet](Event& e) {
       const PhysicsObject* J = nullptr;
       /* leading @TEMP Put in for ANN * /
-      if (e.collection("LargeRadiusJets").size() > 0) {
-        J = e.collection("LargeRadiusJets").at(0);
+      if (e.leading(key_jets, 1).size() > 0) {
+        J = e.leading(key_jets, 1).at(0);
       }
       /**/
       /* smallest tau21DDT @TEMP Taken out for ANN*/
-      float minTau21DDT = inf;
-      for (const PhysicsObject* p : e.collection("LargeRadiusJets")) {
-        if (p->info("tau21DDT") < minTau21DDT) {
-          minTau21DDT = p->info("tau21DDT");
-          J = p;
-        }
-      } /**/
-      if (J) { e.setParticle("Jet", *J); }
+      J = collectionArgmin(e.collection(key_jets), var_tau21DDT);
+      /**/
+      if (J) { e.setParticle(key_jet, J); }
       return true;
     });
 
@@ -457,6 +456,9 @@ int main (int argc, char* argv[]) {
 
     // Event loop.
     // -------------------------------------------------------------------
+    // Draw the per-event object storage from a reusable arena.
+    EventArena::setEnabled(true);
+
     for (const auto& category : categories) {
 
       // Set correct retriever trees.
@@ -469,6 +471,7 @@ int main (int argc, char* argv[]) {
 
       // Loop events
       for (unsigned iEvent = 0; iEvent < nEvents[category]; iEvent++) {
+        EventArena::reset();
         inputTree[category]->GetEvent(iEvent);
 
         // Retrieve collections and events
@@ -1,5 +1,8 @@
 #include "AnalysisTools/Analysis.h"
 
+// ROOT include(s).
+#include "TROOT.h" /* ROOT::EnableThreadSafety */
+
 // For explicit template instantiations.
 #include "TLorentzVector.h"
 #include "AnalysisTools/PhysicsObject.h"
@@ -65,6 +68,23 @@ namespace AnalysisTools {
     m_sum_weights = sum_weights;
     return;
   }
+
+  void Analysis::setConcurrency (const unsigned& nThreads) {
+    m_graphs.clear();
+    if (nThreads > 1) {
+      ROOT::EnableThreadSafety();
+      m_pool = makeUniqueMove(new TaskPool(nThreads));
+    } else {
+      m_pool.reset();
+    }
+    RootLock::setConcurrent(nThreads > 1);
+    return;
+  }
+
+  void Analysis::setBatchSize (const unsigned& size) {
+    m_batchSize = size;
+    return;
+  }
   
   
   // Get method(s).
@@ -183,19 +203,43 @@ namespace AnalysisTools {
   bool Analysis::run (const std::string& category) {
     DEBUG("Entering (actual run method).");
     assert( this->hasCategory(category) );
-    bool passed = true;
-    for (auto& selection : m_selections.at(category)) {
-      DEBUG("  Setting weight.");
-      selection->setWeight(m_weight.at(category));
-      if (m_sum_weights) {
-	selection->setSumWeights(m_sum_weights);
-      }
-      passed &= selection->run();
-      if (!passed && selection->required()) { break; }
-    }
+    bool stopped = false;
+    const bool passed = runSelections_(category, nullptr, stopped);
     DEBUG("Exiting (actual run method).");
     return passed;
   }
+
+  void Analysis::runBuffered (const std::string& category, const BatchCallback& callback) {
+    DEBUG("Entering.");
+    assert( this->hasCategory(category) );
+    ISelection* batched = batched_(category);
+    bool stopped = false;
+    const bool passed = runSelections_(category, batched, stopped);
+    if (stopped) { return; }
+
+    // Without batch mode, the event has been run in full.
+    if (!batched) {
+      if (callback) { callback(0, passed); }
+      return;
+    }
+
+    batched->buffer();
+    m_batchPassed[category].push_back(passed);
+    if (batched->buffered() >= m_batchSize) {
+      runBatch_(category, batched, callback);
+    }
+    DEBUG("Exiting.");
+    return;
+  }
+
+  unsigned Analysis::flush (const std::string& category, const BatchCallback& callback) {
+    assert( this->hasCategory(category) );
+    ISelection* batched = batched_(category);
+    if (!batched) { return 0; }
+    const unsigned N = batched->buffered();
+    runBatch_(category, batched, callback);
+    return N;
+  }
   
   void Analysis::openOutput  (const string& filename) {
     /* Perform checks. */
@@ -282,6 +326,165 @@ namespace AnalysisTools {
     return;
   }
   
+  void Analysis::buildGraph_ (const std::string& category) {
+    Graph& graph = m_graphs[category];
+    graph = Graph();
+
+    // Lazy selections are run on demand, by the selections depending on 
+    // them, rather than as nodes of the graph.
+    std::vector<ISelection*> lazy;
+    for (auto& selection : m_selections.at(category)) {
+      if (selection->lazy()) {
+	lazy.push_back(selection.get());
+      } else {
+	graph.nodes.push_back(selection.get());
+      }
+    }
+    const unsigned N = graph.nodes.size();
+
+    // Lazy selections which may be run by each node, directly or through 
+    // other lazy selections.
+    std::vector< std::vector<char> > demands (N, std::vector<char>(lazy.size(), false));
+    for (unsigned i = 0; i < N; i++) {
+      for (unsigned l = lazy.size(); l-- > 0; ) {
+	demands[i][l] |= graph.nodes[i]->dependsOn(lazy[l]);
+	if (!demands[i][l]) { continue; }
+	for (unsigned m = 0; m < l; m++) {
+	  demands[i][m] |= lazy[l]->dependsOn(lazy[m]);
+	}
+      }
+    }
+
+    graph.nextRequired.assign(N + 1, N);
+    for (unsigned i = N; i-- > 0; ) {
+      graph.nextRequired[i] = (graph.nodes[i]->required() ? i : graph.nextRequired[i + 1]);
+    }
+    graph.nextRequired.pop_back();
+
+    // Node 'i' waits for the earlier node 'j' if either doesn't allow 
+    // concurrency, if 'j' could stop the pipeline before 'i', if either 
+    // depends on the output of the other, or on that of a lazy selection 
+    // run by the other, or if both may run the same lazy selection.
+    graph.inputs.assign(N, std::vector<unsigned>());
+    for (unsigned i = 0; i < N; i++) {
+      ISelection* current = graph.nodes[i];
+      for (unsigned j = 0; j < i; j++) {
+	ISelection* other = graph.nodes[j];
+	bool wait = !current->concurrent() || !other->concurrent();
+	wait |= other->canFail() && graph.nextRequired[j] < i;
+	wait |= current->dependsOn(other) || other->dependsOn(current);
+	for (unsigned l = 0; l < lazy.size() && !wait; l++) {
+	  wait |= demands[i][l] && (demands[j][l] || lazy[l]->dependsOn(other));
+	  wait |= demands[j][l] && lazy[l]->dependsOn(current);
+	}
+	if (wait) {
+	  graph.inputs[i].push_back(j);
+	} else {
+	  graph.concurrent = true;
+	}
+      }
+    }
+
+    // Nodes are skipped if the pipeline has stopped before them, which is 
+    // known once they are started, since all nodes which could stop it 
+    // are inputs.
+    graph.results.assign(N, true);
+    for (unsigned i = 0; i < N; i++) {
+      ISelection* selection = graph.nodes[i];
+      char*       result    = &graph.results[i];
+      const std::vector<unsigned>* nextRequired = &graph.nextRequired;
+      graph.tasks.push_back([this, i, N, selection, result, nextRequired] () {
+	  if (i >= m_end) { return; }
+	  unsigned first = m_firstFailure;
+	  if (first < N && nextRequired->at(first) < i) { return; }
+	  *result = selection->run();
+	  if (*result) { return; }
+	  while (first > i && !m_firstFailure.compare_exchange_weak(first, i)) {}
+	});
+    }
+    DEBUG("Running %d selections as a graph of %d nodes in category '%s'%s.", m_selections.at(category).size(), N, category.c_str(), (graph.concurrent ? "" : ", one at a time"));
+    return;
+  }
+
+  bool Analysis::runSelections_ (const std::string& category, const ISelection* last, bool& stopped) {
+    stopped = false;
+    if (m_pool) {
+      if (m_graphs.count(category) == 0) { buildGraph_(category); }
+      if (m_graphs.at(category).concurrent) { return runConcurrently_(category, last, stopped); }
+    }
+    bool passed = true;
+    for (auto& selection : m_selections.at(category)) {
+      DEBUG("  Setting weight.");
+      selection->setWeight(m_weight.at(category));
+      if (m_sum_weights) {
+	selection->setSumWeights(m_sum_weights);
+      }
+      if (selection.get() == last) { break; }
+      if (selection->lazy()) {
+	DEBUG("  Deferring lazy selection '%s'.", selection->name().c_str());
+	selection->invalidate();
+	continue;
+      }
+      passed &= selection->run();
+      if (!passed && selection->required()) {
+	stopped = true;
+	break;
+      }
+    }
+    return passed;
+  }
+
+  bool Analysis::runConcurrently_ (const std::string& category, const ISelection* last, bool& stopped) {
+    Graph& graph = m_graphs.at(category);
+    const unsigned N = graph.nodes.size();
+
+    // Prepare all selections up to 'last', as in 'run'.
+    m_end = 0;
+    for (auto& selection : m_selections.at(category)) {
+      selection->setWeight(m_weight.at(category));
+      if (m_sum_weights) {
+	selection->setSumWeights(m_sum_weights);
+      }
+      if (selection.get() == last) { break; }
+      if (selection->lazy()) {
+	selection->invalidate();
+      } else {
+	m_end++;
+      }
+    }
+
+    m_firstFailure = N;
+    m_pool->run(graph.tasks, graph.inputs);
+
+    // Write the output trees filled by the tasks.
+    for (auto& selection : m_selections.at(category)) {
+      selection->writeDeferred();
+    }
+
+    const unsigned first = m_firstFailure;
+    stopped = first < N && graph.nextRequired[first] < m_end;
+    return first == N;
+  }
+  
+  ISelection* Analysis::batched_ (const std::string& category) const {
+    if (m_batchSize == 0) { return nullptr; }
+    const SelectionPtrs& selections = m_selections.at(category);
+    if (selections.empty() || !selections.back()->batchable()) { return nullptr; }
+    return selections.back().get();
+  }
+
+  void Analysis::runBatch_ (const std::string& category, ISelection* selection, const BatchCallback& callback) {
+    std::vector<char>& passed = m_batchPassed[category];
+    if (selection->buffered() > 0) { selection->runBatch(); }
+    if (callback) {
+      for (unsigned k = 0; k < passed.size(); k++) {
+	callback(k, passed[k] && selection->batchResult(k));
+      }
+    }
+    passed.clear();
+    return;
+  }
+  
   /// Explicitly instatiate templates.
   template void Analysis::addSelection< PseudoObjectDefinition<TLorentzVector> >(PseudoObjectDefinition<TLorentzVector>*, const std::string&);
   template void Analysis::addSelection< PseudoObjectDefinition<AnalysisTools::PhysicsObject> >(PseudoObjectDefinition<AnalysisTools::PhysicsObject>*, const std::string&);
@@ -1,6 +1,16 @@
 #include "AnalysisTools/CollectionRetriever.h"
 
 namespace AnalysisTools {
+
+  /// Set method(s).
+  void CollectionRetriever::setDirectBinding (const bool& directBinding) {
+    if (directBinding != m_directBinding) {
+      m_directBinding = directBinding;
+      clear(); // Re-initialise on next retrieval.
+    }
+    return;
+  }
+
   
   /// High-level method(s).
   std::vector<PhysicsObject>* CollectionRetriever::result () {
@@ -15,34 +25,42 @@ namespace AnalysisTools {
 
   void CollectionRetriever::fillCache_ () {
 
+    // Read directly bound branches.
+    load_();
+
     // Get size of first kinematic array, i.e. number of objects in collection
-    const unsigned N = m_formulas[0]->GetNdata();
+    const unsigned N = size_(0);
     m_collection.resize(N);
 
+    // Bound branches hold exactly the values for the current entry, and should all have one for each object.
+    for (const auto& binding : m_bindings) {
+      if (binding && binding->size() != N) {
+	ERROR("Branch '%s' has %u values, but the collection has %u objects.", binding->name.c_str(), binding->size(), N);
+      }
+    }
+
     // Kinematics
     for (unsigned i = 0; i < N; i++) {
       PhysicsObject& p = m_collection.at(i);
+      p.setSchema(&m_schema);
       switch (m_mode) {
       case RetrieverMode::PxPyPzE :
-	for (unsigned j = 1; j < 4; j++) { m_formulas[j]->GetNdata(); }
-	p.SetPxPyPzE(m_formulas[0]->EvalInstance(i),
-		     m_formulas[1]->EvalInstance(i),
-		     m_formulas[2]->EvalInstance(i),
-		     m_formulas[3]->EvalInstance(i));
+	p.SetPxPyPzE(value_(0, i),
+		     value_(1, i),
+		     value_(2, i),
+		     value_(3, i));
 	break;
       case RetrieverMode::PtEtaPhiE :
-	for (unsigned j = 1; j < 4; j++) { m_formulas[j]->GetNdata(); }
-	p.SetPtEtaPhiE(m_formulas[0]->EvalInstance(i),
-		       m_formulas[1]->EvalInstance(i),
-		       m_formulas[2]->EvalInstance(i),
-		       m_formulas[3]->EvalInstance(i));
+	p.SetPtEtaPhiE(value_(0, i),
+		       value_(1, i),
+		       value_(2, i),
+		       value_(3, i));
 	break;
       case RetrieverMode::PtEtaPhiM :
-	for (unsigned j = 1; j < 4; j++) { m_formulas[j]->GetNdata(); }
-	p.SetPtEtaPhiM(m_formulas[0]->EvalInstance(i), 
-		       m_formulas[1]->EvalInstance(i),
-		       m_formulas[2]->EvalInstance(i),
-		       m_formulas[3]->EvalInstance(i));
+	p.SetPtEtaPhiM(value_(0, i), 
+		       value_(1, i),
+		       value_(2, i),
+		       value_(3, i));
 	break;
       case RetrieverMode::TLorentzVector :
 	/* nop -- shouldn't happen */
@@ -55,22 +73,77 @@ namespace AnalysisTools {
     // Adding auxiliary infoformation from TTree branches
     unsigned i_info = (m_mode == RetrieverMode::TLorentzVector ? 1 : 4);
     for (; i_info < m_branches.size(); i_info++) {
-      const std::string name = m_branch_to_name.at(m_branches[i_info]);
+      const InfoKey key = m_schema.key(m_branch_to_name.at(m_branches[i_info]));
       for (unsigned i = 0; i < N; i++) {
- 	m_collection[i].addInfo(name, m_formulas[i_info]->EvalInstance(i));
+ 	m_collection[i].addInfo(key, value_(i_info, i));
       }
     }
 
     // Adding auxiliary information from functions.
     for (const auto& pair : m_infoFunctions) {
-      const std::string name = pair.first;
-      const function< float(const PhysicsObject&) > f = pair.second;
+      const InfoKey key = m_schema.key(pair.first);
+      const function< float(const PhysicsObject&) >& f = pair.second;
       for (unsigned i = 0; i < N; i++) {
-	m_collection[i].addInfo(name, f(m_collection[i]));
+	m_collection[i].addInfo(key, f(m_collection[i]));
       }
     }
 
     return;
   }
 
+  bool CollectionRetriever::bind_ (const std::string& branch) {
+    if (m_bindings.size() == 0) { m_boundTree = m_tree; }
+    m_bindings.emplace_back(nullptr);
+    if (!m_directBinding) { return false; }
+
+    // Only plain branches of supported type, not already read elsewhere.
+    TBranch* pBranch = m_tree->GetBranch(branch.c_str());
+    if (!pBranch || pBranch->GetAddress()) { return false; }
+    const std::string className = pBranch->GetClassName();
+    if (className != "vector<float>" && className != "vector<int>") { return false; }
+
+    std::unique_ptr<BranchBinding> binding (new BranchBinding());
+    binding->name  = branch;
+    binding->isInt = (className == "vector<int>");
+    const int status = (binding->isInt ?
+			m_tree->SetBranchAddress(branch.c_str(), &binding->intsAddress) :
+			m_tree->SetBranchAddress(branch.c_str(), &binding->floatsAddress));
+    if (status < 0) {
+      WARNING("Could not bind branch '%s' (%d). Reading it through a formula instead.", branch.c_str(), status);
+      return false;
+    }
+
+    m_bindings.back() = std::move(binding);
+    return true;
+  }
+
+  void CollectionRetriever::unbind_ () {
+    for (const auto& binding : m_bindings) {
+      if (!binding) { continue; }
+      TBranch* pBranch = m_boundTree->GetBranch(binding->name.c_str());
+      if (pBranch) { m_boundTree->ResetBranchAddress(pBranch); }
+    }
+    m_bindings.clear();
+    m_boundTree = nullptr;
+    return;
+  }
+
+  void CollectionRetriever::load_ () {
+    // For TChains, the branches belong to the current tree, and are looked up again when it changes.
+    TTree* tree = m_tree->GetTree();
+    const int treeNumber = m_tree->GetTreeNumber();
+    const long long entry = tree->GetReadEntry();
+    for (const auto& binding : m_bindings) {
+      if (!binding) { continue; }
+      if (binding->treeNumber != treeNumber) {
+	binding->branch     = tree->GetBranch(binding->name.c_str());
+	binding->treeNumber = treeNumber;
+      }
+      if (binding->branch && binding->branch->GetReadEntry() != entry) {
+	binding->branch->GetEntry(entry);
+      }
+    }
+    return;
+  }
+
 }
@@ -0,0 +1,43 @@
+#include "AnalysisTools/CollectionView.h"
+
+namespace AnalysisTools {
+
+  // Set method(s).
+  void CollectionView::reset (const PhysicsObjects& collection) {
+    m_data    = collection.data();
+    m_size    = collection.size();
+    m_indexed = false;
+    return;
+  }
+
+  void CollectionView::clear () {
+    m_data    = nullptr;
+    m_size    = 0;
+    m_indexed = false;
+    return;
+  }
+
+  void CollectionView::erase (const unsigned& i) {
+    assert(i < size());
+    std::vector<unsigned>& idx = indices();
+    idx.erase(idx.begin() + i);
+    return;
+  }
+
+
+  // Get method(s).
+  std::vector<unsigned>& CollectionView::indices () {
+    if (!m_indexed) {
+      // Copy on write: list all source objects, in order.
+      m_indices.resize(m_size);
+      for (unsigned i = 0; i < m_size; i++) { m_indices[i] = i; }
+      m_indexed = true;
+    }
+    return m_indices;
+  }
+
+  PhysicsObjectPtrs CollectionView::pointers () const {
+    return PhysicsObjectPtrs(begin(), end());
+  }
+
+}
@@ -1,15 +1,29 @@
 #include "AnalysisTools/Cut.h"
+#include "AnalysisTools/ExpressionCut.h"
 
 namespace AnalysisTools {
     
     // Constructor(s).
     // ...
+
+
+    // Factory method(s).
+    template <class T>
+    ExpressionCut<T> Cut<T>::fromExpression (const string& expression) {
+        return ExpressionCut<T>(expression, expression);
+    }
+
+    template <class T>
+    ExpressionCut<T> Cut<T>::fromExpression (const string& name, const string& expression) {
+        return ExpressionCut<T>(name, expression);
+    }
     
     
     // Set method(s).
     template <class T>
     void Cut<T>::clearRanges () {
         m_ranges.clear();
+        this->m_origin = 0;
         return;
     }
     
@@ -43,7 +57,8 @@ namespace AnalysisTools {
         
     template <class T>
     void Cut<T>::setRanges (const Ranges& ranges) {
-        m_ranges = ranges;
+        m_ranges = RangeSet(ranges);
+        this->m_origin = 0;
         return;
     }
     
@@ -56,33 +71,36 @@ namespace AnalysisTools {
     
     template <class T>
     void Cut<T>::addRange (const Range& range) {
-        m_ranges.emplace_back(range);
+        m_ranges.add(range);
+        this->m_origin = 0;
         return;
     }
     
     template <class T>
     void Cut<T>::addRange (const std::pair<float, float>& limits) {
-        m_ranges.emplace_back(Range(limits));
+        m_ranges.add(Range(limits));
+        this->m_origin = 0;
         return;
     }
     
     template <class T>
     void Cut<T>::addRange (const float& down, const float& up) {
-        m_ranges.emplace_back(Range(down, up));
+        m_ranges.add(Range(down, up));
+        this->m_origin = 0;
         return;
     }
     
     template <class T>
     void Cut<T>::addRange (const float& value) {
-        m_ranges.emplace_back(Range(value - eps, value + eps));
+        m_ranges.add(Range(value - eps, value + eps));
+        this->m_origin = 0;
         return;
     }
     
     template <class T>
     void Cut<T>::addRanges (const Ranges& ranges) {
-        for (const Range& range : ranges) {
-            addRange(range);
-        }
+        m_ranges.add(ranges);
+        this->m_origin = 0;
         return;
     }
     
@@ -113,12 +131,14 @@ namespace AnalysisTools {
     template <class T>
     void Cut<T>::setFunction (const std::function< float(const T&) >& f) {
         m_function = f;
+        this->m_origin = 0;
         return;
     }
     
     template <class T> // @asogaard: Move to Localised? (clearChildren)
     void Cut<T>::clearPlots () {
         this->m_plots.clear();
+        m_plan.invalidate();
         return;
     }
     
@@ -142,6 +162,7 @@ namespace AnalysisTools {
                 cout << "<Cut<T>::addPlot> Doesn't recognise template argument of plot '" << plot.name() << "'." << endl;
             }
         }
+        m_plan.invalidate();
         return;
     }
   
@@ -175,126 +196,18 @@ namespace AnalysisTools {
     // High-level management method(s).
     template <class T>
     bool Cut<T>::apply (const T& obj, const float& w) {
-      /**
-       * Performace bottleneck. 
-       * - Is called ca. 20 times per event and;
-       * - accounts for ca. 85% of all instructions/time spend in AnalysisTools.
-       */
-        DEBUG("Entering.");
-        assert(m_function);
-        if (!this->m_initialised) { init(); }
-        
-        // * Pre-cut distributions.
-	/*
-	DEBUG("  Pre-cut distributions.");
-        for (IPlotMacro* plot : plots(CutPosition::Pre)) {
-	  DEBUG("    -- %s", plot->name().c_str());
-            if (plot->name() == "weight") {
-	      ((PlotMacro1D<float>*) plot)->fill(w);
-            } else {
-	      ((PlotMacro1D<T>*) plot)->fill(obj);
-            }
-        }
-	*/
-
-	// Get pointer to parent Selection-type instance.
-	ISelection* parent = dynamic_cast<ISelection*>(this->parent());
-	ValuesCache* pcache = parent->valuesCache();
-
-	// Perform caching.
-	if (parent->performCaching()) {
-	  // Pre-cut plots
-	  for (IPlotMacro* plot : plots(CutPosition::Pre)) {
-	    if (plot->name() == "weight") {
-              pcache->add(plot->name(), w);
-            } else {
-              pcache->add(plot->name(), obj, ((PlotMacro1D<T>*) plot)->function());
-            }
-	  }
-	  // Post-cut plots
-	  for (IPlotMacro* plot : plots(CutPosition::Post)) {
-	    if (plot->name() == "weight" || plot->name() == "CutVariable") { continue; }
-	    pcache->add(plot->name(), obj, ((PlotMacro1D<T>*) plot)->function());
-	  }
-	}
-
-	if (parent->performCaching()) {
-	  DEBUG("  Pre-cut distributions.");
-	  for (IPlotMacro* plot : plots(CutPosition::Pre)) {
-	    plot->fillDirectly(pcache->get(plot->name()));
-	  }
-	} else {
-	  DEBUG("  Pre-cut distributions.");
-	  for (IPlotMacro* plot : plots(CutPosition::Pre)) {
-	    DEBUG("    -- %s", plot->name().c_str());
-            if (plot->name() == "weight") {
-              ((PlotMacro1D<float>*) plot)->fill(w);
-            } else {
-              ((PlotMacro1D<T>*) plot)->fill(obj);
-            }
-	  }
-	}
-        
-        // * Selection.
-	DEBUG("  Selection.");
-        bool passes = false;
-        float val;
-	if (parent->performCaching()) {
-	  val = pcache->get("CutVariable");
-	} else {
-	  val = m_function(obj);
-	}
-        if (m_ranges.size()) {
-            for (const Range& range : m_ranges) {
-                passes |= range.contains(val);
-                if (passes) { break; }
-            }
-        } else {
-            passes = (bool) val;
-        }
-        
-        // * Post-cut distributions.
-	/*
-	  if (passes) {
-	    DEBUG("  Post-cut distributions.");
-            for (IPlotMacro* plot : plots(CutPosition::Post)) {
-                if (plot->name() == "weight") {
-		  ((PlotMacro1D<float>*) plot)->fill(w);
-                } else {
-		  ((PlotMacro1D<T>*) plot)->fill(obj);
-                }
-            }
-        }
-	*/
-
-	if (parent->performCaching()) {
-	  if (passes) {
-	    DEBUG("  Post-cut distributions.");
-	    for (IPlotMacro* plot : plots(CutPosition::Post)) {
-	      plot->fillDirectly(pcache->get(plot->name()));
-	    }
-	  }
-	} else {
-	  if (passes) {
-	    DEBUG("  Post-cut distributions.");
-	    for (IPlotMacro* plot : plots(CutPosition::Post)) {
-	      if (plot->name() == "weight") {
-		((PlotMacro1D<float>*) plot)->fill(w);
-	      } else {
-		((PlotMacro1D<T>*) plot)->fill(obj);
-	      }
-	    }
-	  }
-	}
+        return apply_(obj, w, m_function);
+    }
 
-	DEBUG("  Filling trees.");
-        this->m_trees[CutPosition::Pre]->Fill();
-        if (passes) {
-            this->m_trees[CutPosition::Post]->Fill();
-        }
+    template <class T>
+    void Cut<T>::apply (const std::vector<T>& objects, std::vector<unsigned>& indices, const float& w) {
+        apply_(objects, indices, w, m_function);
+        return;
+    }
 
-	DEBUG("Exiting.");
-        return passes;
+    template <class T>
+    Cut<T>* Cut<T>::clone () const {
+        return new Cut<T>(*this);
     }
     
     
@@ -302,8 +215,14 @@ namespace AnalysisTools {
     template <class T>
     void Cut<T>::init () {
         DEBUG("Entering.");
+        if (!m_bookkeeping && plots().empty()) {
+	    // Pure filter; nothing to fill.
+	    this->m_initialised = true;
+	    return;
+        }
         assert ( this->dir() );
         
+        RootLock lock;
         this->dir()->cd();
         
         this->m_trees[CutPosition::Pre]  = makeUniqueMove( new TTree("Precut",  "TTree with (pre-)cut value distribution") );
@@ -313,18 +232,20 @@ namespace AnalysisTools {
             m_variable = "CutVariable";
         }
         
-        PlotMacro1D<T>     precut (m_variable);
-        PlotMacro1D<T>     postcut(m_variable);
-        PlotMacro1D<float> weight ("weight");
-        
-        precut .setFunction(m_function);
-        postcut.setFunction(m_function);
-        weight .setFunction([](const float& w) { return w; });
-        
-        addPlot(CutPosition::Pre,  weight);
-        addPlot(CutPosition::Pre,  precut);
-        addPlot(CutPosition::Post, weight);
-        addPlot(CutPosition::Post, postcut);
+        if (m_bookkeeping) {
+            PlotMacro1D<T>     precut (m_variable);
+            PlotMacro1D<T>     postcut(m_variable);
+            PlotMacro1D<float> weight ("weight");
+            
+            precut .setFunction(m_function);
+            postcut.setFunction(m_function);
+            weight .setFunction([](const float& w) { return w; });
+            
+            addPlot(CutPosition::Pre,  weight);
+            addPlot(CutPosition::Pre,  precut);
+            addPlot(CutPosition::Post, weight);
+            addPlot(CutPosition::Post, postcut);
+        }
         
         
         for (IPlotMacro* plot : plots(CutPosition::Pre))  { plot->setTree(this->m_trees[CutPosition::Pre] .get());  }
@@ -334,6 +255,19 @@ namespace AnalysisTools {
 	DEBUG("Exiting.");
         return;
     }
+
+    template <class T>
+    void Cut<T>::compile_ () {
+        DEBUG("Compiling execution plan for cut '%s'.", this->name().c_str());
+        assert( this->m_initialised );
+        m_plan.compile(this->parent(),
+		       plots(CutPosition::Pre),
+		       plots(CutPosition::Post),
+		       this->m_trees[CutPosition::Pre] .get(),
+		       this->m_trees[CutPosition::Post].get(),
+		       m_variable);
+        return;
+    }
     
 }
 
@@ -0,0 +1,79 @@
+#include "AnalysisTools/CutScheduler.h"
+
+namespace AnalysisTools {
+
+  // Set method(s).
+  void CutScheduler::init (const std::vector<IOperation*>& operations, const std::vector<bool>& reorderable, const unsigned& warmup, const unsigned& branch) {
+    assert( operations.size() == reorderable.size() );
+    const unsigned N = operations.size();
+
+    m_warmup = warmup;
+    m_events = 0;
+    m_measuring = true;
+
+    m_names .clear();
+    m_order .clear();
+    m_stats .assign(N, Stats());
+    m_groupMembers.clear();
+
+    // Group consecutive reorderable cuts.
+    bool open = false;
+    for (unsigned i = 0; i < N; i++) {
+      m_names.push_back(operations[i]->name());
+      m_order.push_back(i);
+
+      if (i == branch) { open = false; }
+      if (reorderable[i]) {
+	if (!open) {
+	  m_groupMembers.emplace_back();
+	  open = true;
+	}
+	m_groupMembers.back().push_back(i);
+      } else {
+	open = false;
+      }
+    }
+
+    m_initialised = true;
+    return;
+  }
+
+
+  // High-level management method(s).
+  void CutScheduler::end () {
+    if (!m_measuring) { return; }
+    if (++m_events < m_warmup) { return; }
+    reorder_();
+    m_measuring = false;
+    return;
+  }
+
+
+  // Low-level management method(s).
+  void CutScheduler::reorder_ () {
+    // Cost per rejected candidate, i.e. the expected time spent on a candidate before it is rejected.
+    auto rank = [this] (const unsigned& i) {
+      const Stats& stats = m_stats[i];
+      if (stats.nIn == 0 || stats.nPassed == stats.nIn) { return std::numeric_limits<double>::infinity(); }
+      return (stats.time / stats.nIn) / (1. - stats.nPassed / (double) stats.nIn);
+    };
+
+    for (unsigned group = 0; group < m_groupMembers.size(); group++) {
+      const std::vector<unsigned>& members = m_groupMembers[group];
+      if (members.size() < 2) { continue; }
+
+      // Members are consecutive in the declared order; reorder them in-place.
+      std::vector<unsigned> sorted = members;
+      std::stable_sort(sorted.begin(), sorted.end(), [&rank] (const unsigned& a, const unsigned& b) { return rank(a) < rank(b); });
+      if (sorted == members) { continue; }
+
+      std::copy(sorted.begin(), sorted.end(), m_order.begin() + members.front());
+
+      std::string names = "";
+      for (const unsigned& i : sorted) { names += (names == "" ? "" : ", ") + m_names[i]; }
+      INFO("Reordered cuts as: %s", names.c_str());
+    }
+    return;
+  }
+
+}
@@ -1,96 +1,390 @@
 #include "AnalysisTools/Event.h"
 
+// STL include(s).
+#include <type_traits> /* std::is_same */
+
 namespace AnalysisTools {
 
     // Constructor(s).
     // ...
-    
+
+    // Schema method(s).
+    InfoKey Event::key (const string& name) {
+        return schema()->key(name);
+    }
+
+    InfoSchema* Event::schema () {
+        static InfoSchema s_schema;
+        return &s_schema;
+    }
+
     // Set method(s).
     void Event::addInfo (const string& name, const float& val) {
-        if ( m_info.count(name) != 0 ) {
-	    ERROR("Info named '%s' already exists.", name.c_str());
+        addInfo(key(name), val);
+        return;
+    }
+
+    void Event::addInfo (const InfoKey& key, const float& val) {
+        if ( hasInfo(key) ) {
+	    ERROR("Info named '%s' already exists.", schema()->name(key.slot).c_str());
 	}
-        m_info[name] = val;
+        grow_(key.slot);
+        m_info      [key.slot] = val;
+        m_infoStates[key.slot] = Set;
+        return;
+    }
+
+    template<class T>
+    void Event::bindInfo (const string& name, const T* address) {
+        bindInfo(key(name), address);
         return;
     }
-    
+
+    template<class T>
+    void Event::bindInfo (const InfoKey& key, const T* address) {
+        assert( address );
+        if ( has_(m_infoStates, key) && m_infoStates[key.slot] != Bound ) {
+	    ERROR("Info named '%s' already exists.", schema()->name(key.slot).c_str());
+	}
+        grow_(key.slot);
+        Binding& binding = m_bindings[key.slot];
+        binding.address = address;
+        if      (std::is_same<T, unsigned>::value) { binding.type = Unsigned; }
+        else if (std::is_same<T, double>  ::value) { binding.type = Double; }
+        else if (std::is_same<T, float>   ::value) { binding.type = Float; }
+        else if (std::is_same<T, bool>    ::value) { binding.type = Bool; }
+        else                                       { binding.type = Int; }
+        m_infoStates[key.slot] = Bound;
+        return;
+    }
+
     void Event::addCollection (const string& name, PhysicsObjects* collection) {
-        if ( m_collections.count(name) != 0 ) {
-	    ERROR("Collection named '%s' already exists.", name.c_str());
+        addCollection(key(name), collection);
+        return;
+    }
+
+    void Event::addCollection (const InfoKey& key, PhysicsObjects* collection) {
+        if ( hasCollection(key) ) {
+	    ERROR("Collection named '%s' already exists.", schema()->name(key.slot).c_str());
 	}
-	m_collections[name] = {};
-	for (const PhysicsObject& p : *collection) {
-	  m_collections[name].push_back(&p);
+        grow_(key.slot);
+	m_collections     [key.slot].reset(*collection);
+	m_collectionStates[key.slot] = Set;
+	invalidate_(key.slot);
+        return;
+    }
+
+    void Event::addCollection (const string& name, const function< PhysicsObjects*() >& trigger) {
+        addCollection(key(name), trigger);
+        return;
+    }
+
+    void Event::addCollection (const InfoKey& key, const function< PhysicsObjects*() >& trigger) {
+        if ( hasCollection(key) ) {
+	    ERROR("Collection named '%s' already exists.", schema()->name(key.slot).c_str());
 	}
+        grow_(key.slot);
+	m_triggers        [key.slot] = trigger;
+	m_collectionStates[key.slot] = Pending;
+	invalidate_(key.slot);
         return;
     }
-    
+
     void Event::addGRL (GRL* grl) {
         assert( grl );
         m_grl = grl;
         return;
     }
-    
+
     void Event::setParticle (const string& name, const PhysicsObject& particle) {
-        m_particles[name] = particle;
+        setParticle(key(name), particle);
         return;
     }
-    
-    
+
+    void Event::setParticle (const InfoKey& key, const PhysicsObject& particle) {
+        grow_(key.slot);
+        m_particles     [key.slot] = particle;
+        m_particleStates[key.slot] = Set;
+        return;
+    }
+
+    void Event::setParticle (const string& name, const PhysicsObject* particle) {
+        setParticle(key(name), particle);
+        return;
+    }
+
+    void Event::setParticle (const InfoKey& key, const PhysicsObject* particle) {
+        assert( particle );
+        grow_(key.slot);
+        m_particleRefs  [key.slot] = particle;
+        m_particleStates[key.slot] = Bound;
+        return;
+    }
+
+    void Event::setBase (const Event* base) {
+        assert(base != this);
+        m_base = base;
+        return;
+    }
+
+
     // Get method(s).
     bool Event::hasCollection (const string& name) const {
-      //INFO("Looking for '%s'", name.c_str());
-        return m_collections.count(name) > 0;
+        InfoKey key;
+        return schema()->find(name, key) && hasCollection(key);
+    }
+
+    bool Event::hasCollection (const InfoKey& key) const {
+        return has_(m_collectionStates, key) || (m_base && m_base->hasCollection(key));
     }
 
-    const PhysicsObjectPtrs& Event::collection (const string& name) const {
-        if ( m_collections.count(name) == 0 ) {
+    const CollectionView& Event::collection (const string& name) const {
+        InfoKey key;
+        if ( !schema()->find(name, key) ) {
 	    ERROR("No collection named '%s' exists.", name.c_str());
 	}
-        return m_collections.at(name);
+        return collection(key);
     }
-    
-    PhysicsObjectPtrs& Event::mutableCollection (const string& name) {
-        if ( m_collections.count(name) == 0 ) {
+
+    const CollectionView& Event::collection (const InfoKey& key) const {
+        if ( !has_(m_collectionStates, key) ) {
+	    if ( m_base && m_base->hasCollection(key) ) { return m_base->collection(key); }
+	    ERROR("No collection named '%s' exists.", schema()->name(key.slot).c_str());
+	}
+        if ( m_collectionStates[key.slot] == Pending ) { resolve_(key.slot); }
+        return m_collections[key.slot];
+    }
+
+    CollectionView& Event::mutableCollection (const string& name) {
+        InfoKey key;
+        if ( !schema()->find(name, key) ) {
 	    ERROR("No collection named '%s' exists.", name.c_str());
 	}
-        return m_collections.at(name);
+        return mutableCollection(key);
     }
-    
+
+    CollectionView& Event::mutableCollection (const InfoKey& key) {
+        if ( !hasCollection(key) ) {
+	    ERROR("No collection named '%s' exists.", schema()->name(key.slot).c_str());
+	}
+        if ( !has_(m_collectionStates, key) ) {
+	    // Copy on write: the view of the base collection is copied into this event.
+	    grow_(key.slot);
+	    m_collections     [key.slot] = m_base->collection(key);
+	    m_collectionStates[key.slot] = Set;
+	}
+        if ( m_collectionStates[key.slot] == Pending ) { resolve_(key.slot); }
+        invalidate_(key.slot);
+        return m_collections[key.slot];
+    }
+
+    const CollectionView& Event::leading (const string& name, const unsigned& k, const string& by) const {
+        InfoKey key;
+        if ( !schema()->find(name, key) ) {
+	    ERROR("No collection named '%s' exists.", name.c_str());
+	}
+        return leading(key, k, by);
+    }
+
+    const CollectionView& Event::leading (const InfoKey& key, const unsigned& k, const string& by) const {
+        const CollectionView& source = collection(key);
+
+        // Find the memoised ordering, if any.
+        if (key.slot >= m_orderings.size()) {
+	    m_orderings.resize(std::max(key.slot + 1, schema()->size()));
+        }
+        Ordering* ordering = nullptr;
+        for (Ordering& o : m_orderings[key.slot]) {
+	    if (o.by == by) { ordering = &o; break; }
+        }
+        if (!ordering) {
+	    m_orderings[key.slot].emplace_back();
+	    ordering = &m_orderings[key.slot].back();
+	    ordering->by = by;
+        }
+        if (ordering->valid && ordering->k >= k) { return ordering->view; }
+
+        // Order the objects, breaking ties by their position in the source collection.
+        ordering->view = source;
+        if (by == "") {
+	    ordering->view.sortLeading(k, [] (const PhysicsObject* a, const PhysicsObject* b) {
+		return a->Pt() > b->Pt() || (a->Pt() == b->Pt() && a < b);
+	      });
+        } else if (!source.empty()) {
+	    InfoKey info;
+	    if ( !source.front()->schema()->find(by, info) ) {
+	        ERROR("No info named '%s' exists for the objects in collection '%s'.", by.c_str(), schema()->name(key.slot).c_str());
+	    }
+	    ordering->view.sortLeading(k, [&info] (const PhysicsObject* a, const PhysicsObject* b) {
+		const double va = a->info(info), vb = b->info(info);
+		return va > vb || (va == vb && a < b);
+	      });
+        }
+        ordering->k     = k;
+        ordering->valid = true;
+        return ordering->view;
+    }
+
     float Event::info (const string& name) const {
-        assert(hasInfo(name));
-        return m_info.at(name);
+        InfoKey key;
+        if ( !schema()->find(name, key) ) {
+	    ERROR("No info named '%s' exists.", name.c_str());
+	}
+        return info(key);
     }
-    
+
     bool Event::hasInfo (const string& name) const {
-        return m_info.count(name) > 0;
+        InfoKey key;
+        return schema()->find(name, key) && hasInfo(key);
     }
-    
+
     const PhysicsObject& Event::particle (const string& name) const {
-        if (!hasParticle(name)) {
+        InfoKey key;
+        if ( !schema()->find(name, key) ) {
 	    ERROR("No particle named '%s' exists.", name.c_str());
 	}
-        return m_particles.at(name);
+        return particle(key);
+    }
+
+    const PhysicsObject& Event::particle (const InfoKey& key) const {
+        if (!has_(m_particleStates, key)) {
+	    if (m_base && m_base->hasParticle(key)) { return m_base->particle(key); }
+	    ERROR("No particle named '%s' exists.", schema()->name(key.slot).c_str());
+	}
+        return (m_particleStates[key.slot] == Bound ? *m_particleRefs[key.slot] : m_particles[key.slot]);
     }
-    
+
     bool Event::hasParticle (const string& name) const {
-         return m_particles.count(name) > 0;
+         InfoKey key;
+         return schema()->find(name, key) && hasParticle(key);
+    }
+
+    bool Event::hasParticle (const InfoKey& key) const {
+         return has_(m_particleStates, key) || (m_base && m_base->hasParticle(key));
     }
-    
+
     GRL* Event::grl () const {
+        if (!m_grl && m_base) { return m_base->grl(); }
         assert( m_grl );
         return m_grl;
     }
-    
-    
-    
+
+
+
     // High-level management method(s).
     void Event::clear () {
-      m_info.clear();
-      m_collections.clear();
-      m_particles.clear();
+      // Only mark slots as empty; the storage is kept for the next event.
+      std::fill(m_infoStates      .begin(), m_infoStates      .end(), Empty);
+      std::fill(m_collectionStates.begin(), m_collectionStates.end(), Empty);
+      std::fill(m_particleStates  .begin(), m_particleStates  .end(), Empty);
+      for (unsigned slot = 0; slot < m_orderings.size(); slot++) { invalidate_(slot); }
       m_grl = nullptr;
       return;
     }
-    
+
+    void Event::assign (const Event& other) {
+      if (this == &other) { return; }
+      clear();
+      const unsigned size = other.m_infoStates.size();
+      if (size > 0) { grow_(size - 1); }
+      // Only occupied slots are copied, element-wise, such that e.g. the index lists of the collections reuse their capacity.
+      for (unsigned slot = 0; slot < size; slot++) {
+	if ((m_infoStates[slot] = other.m_infoStates[slot]) == Set) {
+	  m_info[slot] = other.m_info[slot];
+	} else if (m_infoStates[slot] == Bound) {
+	  m_bindings[slot] = other.m_bindings[slot];
+	}
+	if ((m_collectionStates[slot] = other.m_collectionStates[slot]) == Set) {
+	  m_collections[slot] = other.m_collections[slot];
+	} else if (m_collectionStates[slot] == Pending) {
+	  m_triggers[slot] = other.m_triggers[slot];
+	}
+	if ((m_particleStates[slot] = other.m_particleStates[slot]) == Set) {
+	  m_particles[slot] = other.m_particles[slot];
+	} else if (m_particleStates[slot] == Bound) {
+	  m_particleRefs[slot] = other.m_particleRefs[slot];
+	}
+      }
+      m_grl  = other.m_grl;
+      m_base = other.m_base;
+      return;
+    }
+
+    void Event::snapshot (const Event& other, std::list<PhysicsObjects>& storage) {
+      assert(this != &other);
+      clear();
+      m_base = nullptr;
+      InfoKey key;
+      key.schema = schema();
+      for (key.slot = 0; key.slot < schema()->size(); key.slot++) {
+	if (other.hasInfo(key)) {
+	  addInfo(key, other.info(key));
+	}
+	if (other.hasCollection(key)) {
+	  const CollectionView& view = other.collection(key);
+	  storage.emplace_back();
+	  PhysicsObjects& objects = storage.back();
+	  objects.reserve(view.size());
+	  for (const PhysicsObject* object : view) {
+	    objects.push_back(*object);
+	    objects.back().detach();
+	  }
+	  addCollection(key, &objects);
+	}
+	if (other.hasParticle(key)) {
+	  setParticle(key, other.particle(key));
+	  m_particles[key.slot].detach();
+	}
+      }
+      for (const Event* event = &other; event && !m_grl; event = event->m_base) {
+	m_grl = event->m_grl;
+      }
+      return;
+    }
+
+
+    // Low-level management method(s).
+    void Event::grow_ (const unsigned& slot) {
+        if (slot < m_infoStates.size()) { return; }
+        // Make room for all names registered so far, to avoid growing again for each new one.
+        const unsigned size = std::max(slot + 1, schema()->size());
+        m_info            .resize(size, 0.);
+        m_infoStates      .resize(size, Empty);
+        m_bindings        .resize(size);
+        m_collections     .resize(size);
+        m_triggers        .resize(size);
+        m_collectionStates.resize(size, Empty);
+        m_particles       .resize(size);
+        m_particleRefs    .resize(size, nullptr);
+        m_particleStates  .resize(size, Empty);
+        return;
+    }
+
+    void Event::invalidate_ (const unsigned& slot) const {
+        if (slot >= m_orderings.size()) { return; }
+        for (Ordering& ordering : m_orderings[slot]) {
+	    ordering.valid = false;
+        }
+        return;
+    }
+
+    void Event::resolve_ (const unsigned& slot) const {
+        m_collections     [slot].reset(*m_triggers[slot]());
+        m_collectionStates[slot] = Set;
+        return;
+    }
+
+
+    // Explicitly instantiate template method(s).
+    template void Event::bindInfo<unsigned> (const string& name, const unsigned* address);
+    template void Event::bindInfo<double>   (const string& name, const double*   address);
+    template void Event::bindInfo<float>    (const string& name, const float*    address);
+    template void Event::bindInfo<bool>     (const string& name, const bool*     address);
+    template void Event::bindInfo<int>      (const string& name, const int*      address);
+    template void Event::bindInfo<unsigned> (const InfoKey& key, const unsigned* address);
+    template void Event::bindInfo<double>   (const InfoKey& key, const double*   address);
+    template void Event::bindInfo<float>    (const InfoKey& key, const float*    address);
+    template void Event::bindInfo<bool>     (const InfoKey& key, const bool*     address);
+    template void Event::bindInfo<int>      (const InfoKey& key, const int*      address);
+
 }
@@ -0,0 +1,94 @@
+#include "AnalysisTools/EventArena.h"
+
+// STL include(s).
+#include <vector>
+#include <memory> /* std::unique_ptr */
+#include <atomic> /* std::atomic */
+#include <algorithm> /* std::max */
+
+namespace AnalysisTools {
+
+  namespace {
+
+    // Global state.
+    std::atomic<bool>     s_enabled    (false);
+    std::atomic<unsigned> s_generation (1);
+
+    /**
+     * Arena of a single thread. Rewinds itself on the first allocation in a new event generation.
+     */
+    struct ThreadArena {
+
+      // Size of each new block, unless a single allocation requires more.
+      static const std::size_t s_blockSize = 64 * 1024;
+
+      std::vector< std::unique_ptr<char[]> > blocks;
+      std::vector<std::size_t>               sizes;
+      unsigned    block      = 0; // Current block.
+      std::size_t offset     = 0; // Offset into the current block.
+      unsigned    generation = 0;
+
+      void* allocate (const std::size_t& bytes, const std::size_t& alignment) {
+	if (generation != s_generation.load(std::memory_order_relaxed)) {
+	  generation = s_generation.load(std::memory_order_relaxed);
+	  block  = 0;
+	  offset = 0;
+	}
+	while (true) {
+	  if (block < blocks.size()) {
+	    const std::size_t address = reinterpret_cast<std::size_t>(blocks[block].get()) + offset;
+	    const std::size_t padding = (alignment - address % alignment) % alignment;
+	    if (offset + padding + bytes <= sizes[block]) {
+	      void* output = blocks[block].get() + offset + padding;
+	      offset += padding + bytes;
+	      return output;
+	    }
+	    // Move on to the next block, which might have been allocated in a previous event.
+	    block++;
+	    offset = 0;
+	    continue;
+	  }
+	  const std::size_t size = std::max(s_blockSize, bytes + alignment);
+	  blocks.emplace_back(new char[size]);
+	  sizes .push_back(size);
+	}
+      }
+    };
+
+    ThreadArena& threadArena () {
+      static thread_local ThreadArena s_arena;
+      return s_arena;
+    }
+
+  } // namespace
+
+
+  // Set method(s).
+  void EventArena::setEnabled (const bool& enabled) {
+    s_enabled = enabled;
+    return;
+  }
+
+
+  // Get method(s).
+  bool EventArena::enabled () {
+    return s_enabled.load(std::memory_order_relaxed);
+  }
+
+  unsigned EventArena::generation () {
+    return s_generation.load(std::memory_order_relaxed);
+  }
+
+
+  // High-level management method(s).
+  void EventArena::reset () {
+    // Skip zero, which marks heap allocators.
+    if (++s_generation == 0) { ++s_generation; }
+    return;
+  }
+
+  void* EventArena::allocate (const std::size_t& bytes, const std::size_t& alignment) {
+    return threadArena().allocate(bytes, alignment);
+  }
+
+}
@@ -16,9 +16,22 @@ namespace AnalysisTools {
   }
 
   void EventRetriever::fillCache_ () {
+    // Resolve names once.
+    if (m_branchKeys.size() != m_branches.size()) {
+      m_branchKeys.clear();
+      for (const std::string& branch : m_branches) {
+	m_branchKeys.push_back(Event::key(m_branch_to_name.at(branch)));
+      }
+    }
+    if (m_functionKeys.size() != m_infoFunctions.size()) {
+      m_functionKeys.clear();
+      for (const auto& pair : m_infoFunctions) {
+	m_functionKeys.push_back(Event::key(pair.first));
+      }
+    }
+
     // Adding auxiliary information from TTree branches
     for (unsigned i = 0; i < m_branches.size(); i++) {
-      const std::string name = m_branch_to_name.at(m_branches[i]);
 
       // If string-type branch.
       if (m_formulas[i]->IsString()) {
@@ -28,15 +41,14 @@ namespace AnalysisTools {
 	}
       } else {
 	// Otherwise, evaluate as a _single_ floating point value
-	m_event.addInfo(name, m_formulas[i]->EvalInstance());
+	m_event.addInfo(m_branchKeys[i], m_formulas[i]->EvalInstance());
       }
     }
 
     // Adding auxiliary information from functions.
+    unsigned i = 0;
     for (const auto& pair : m_infoFunctions) {
-      const std::string name = pair.first;
-      const function< float(const Event&) > f = pair.second;
-      m_event.addInfo(name, f(m_event));
+      m_event.addInfo(m_functionKeys[i++], pair.second(m_event));
     }
 
     return;
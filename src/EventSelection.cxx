@@ -51,95 +51,86 @@ namespace AnalysisTools {
 	  this->valuesCache()->clear();
 	}
 
+	// Make sure that the operations shared by all categories have been found.
+	if (not m_hasFoundSharedPrefix) { findSharedPrefix_(); }
+
+	// Set correct MC weight, if possibly.
+	const float weight = weight_();
+
+	const std::vector<string>& categories = this->m_categories;
+
+	// Set up the content shared by all categories.
+	prepareSharedEvent_();
+
+	// Run shared operations.
+	// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+	// The operations common to all categories are only run once, on the 
+	// event of the first category, which is then copied to the other 
+	// categories at the branch point. The cutflows of all categories are 
+	// filled with the result.
+	bool     sharedPasses = true;
+	unsigned sharedCuts   = 1;
+	if (m_sharedPrefix > 0) {
+	    const string& first = categories.front();
+	    DEBUG("  Running %d operations shared by all categories, on category '%s'.", m_sharedPrefix, first.c_str());
+
+	    std::vector<TH1F*>& cutflows = m_runCutflows;
+	    cutflows.clear();
+	    for (const auto& category : categories) {
+	        if (!this->hasCutflow(category)) { this->setupCutflow(category); }
+		cutflows.push_back(this->m_cutflow[category].get());
+	    }
+
+	    prepareEvent_(first);
+	    for (TH1F* cutflow : cutflows) { cutflow->Fill(0., weight); }
+
+	    sharedPasses = runOperations_(first, 0, m_sharedPrefix, cutflows, weight, sharedCuts);
+
+	    // Fork the event at the branch point, before the first category 
+	    // moves on.
+	    if (sharedPasses) {
+	        for (const auto& category : categories) {
+		    if (category != first) { m_events[category].assign(m_events[first]); }
+		}
+	    }
+	}
+
 	// Loop categories (Nominal, ...)
-        for (const auto& category : this->categories()) {
+        for (const auto& category : categories) {
 	    DEBUG("  Category: '%s'", category.c_str());
 
-             // Setup
-	    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-
-	    // Initialise cutflow histogram.
-            if (!this->hasCutflow(category)) { this->setupCutflow(category); }
+	    CutScheduler* scheduler = this->scheduler_(category, m_sharedPrefix);
+	    unsigned iCut = sharedCuts;
 	    
-	    // Initialise new Event.
-            m_events[category] = m_input ? *m_input : Event();
-            m_passes[category] = true;
-
-	    // Add all available auxiliary information.
-            for (const auto& name_val : this->infoContainer<unsigned>()) {
-                m_events[category].addInfo(name_val.first, (double) *name_val.second);
-            }
-            for (const auto& name_val : this->infoContainer<double>()) {
-                m_events[category].addInfo(name_val.first, (double) *name_val.second);
-            }
-            for (const auto& name_val : this->infoContainer<float>()) {
-                m_events[category].addInfo(name_val.first, (double) *name_val.second);
-            }
-            for (const auto& name_val : this->infoContainer<bool>()) {
-                m_events[category].addInfo(name_val.first, (double) *name_val.second);
-            }            
-            for (const auto& name_val : this->infoContainer<int>()) {
-                m_events[category].addInfo(name_val.first, (double) *name_val.second);
-            }
-
-	    // Add all collections found above.
-            for (auto& name_pointer : m_collectionLinks[category]) {	      
-                m_events[category].addCollection(name_pointer.first, name_pointer.second);
-            }
-            
-	    // Set correct MC weight, if possibly.
-            float weight = 1.;
-            if (this->m_weight) {
-                weight = *this->m_weight;
-            }
-            if (this->m_sum_weights && *this->m_sum_weights != 0) {
-                weight /= *this->m_sum_weights;
-            }
-            
-
-             // Run selection.
-	    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-
-	    // Initialise the cut counter.
-            unsigned iCut = 0;
-	    // Fill first ('All') bin in cutflow
-            this->m_cutflow[category]->Fill(iCut++, weight);
-
-	    // Loop operations.
-	    // @TODO: - Branching?
-	    for (IOperation* iop : this->operations(category)) { 
-	        DEBUG("    Cut %d/%d", iCut, this->m_operations[category].size());
-                //bool branch = (this->m_branch >= 0) && (iCut > this->m_branch); // iCut in [1, N]
-                //if (!branch) { continue; }
-              
-		// Cast IOperation to either Operation or Cut, in order to call
-		// 'apply' with the correct signature.
-		DEBUG("      Casting IOperation '%s'", iop->name().c_str());
-
-                bool passes = false;
-		if        (iop->operationType() == OperationType::Operation) {
-		  Operation<Event>* op  = static_cast< Operation<Event>* >(iop);
-		  passes = op->apply(this->m_events[category], weight);
-		} else if (iop->operationType() == OperationType::Cut) {
-		  Cut<Event>*       cut = static_cast< Cut<Event>* >      (iop);
-		  passes = cut->apply(this->m_events[category], weight);
-		} else {
-		  WARNING("Operation could not be cast to any known type.");
+	    if (m_sharedPrefix > 0) {
+	      
+	        // Continue from the branch point.
+	        m_passes[category] = sharedPasses;
+		if (!sharedPasses) {
+		    if (scheduler) { scheduler->end(); }
+		    continue;
 		}
+		
+	    } else {
 
-		// Store whether event passed the current operation.
-		DEBUG("      Storing whether the cut was passed (%s).", (passes ? "Yes" : "No"));
-                m_passes[category] &= passes;
+                // Setup
+	        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-		// If event didn't pass, stop or this category.
-                if (!m_passes[category]) { break; }
+	        // Initialise cutflow histogram.
+                if (!this->hasCutflow(category)) { this->setupCutflow(category); }
 
-		// Fill the cutflow, and increment cut counter, but only if the
-		// current operation was in fact a cut.
-		if (iop->operationType() != OperationType::Cut) { continue; }
-                this->m_cutflow[category]->Fill(iCut++, weight);
-            }
-            
+		// Initialise new Event.
+		prepareEvent_(category);
+		
+		// Fill first ('All') bin in cutflow
+		this->m_cutflow[category]->Fill(0., weight);
+	    }
+
+            // Run selection.
+	    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+	    m_runCutflows.assign(1, this->m_cutflow[category].get());
+	    m_passes[category] = runOperations_(category, m_sharedPrefix, this->m_operations[category].size(), m_runCutflows, weight, iCut);
+	    if (scheduler) { scheduler->end(); }
         }
 
 	// Store that this selection has run.
@@ -151,6 +142,146 @@ namespace AnalysisTools {
         return m_passes.size() == 0 || (std::count_if(m_passes.begin(), m_passes.end(), [](const pair<string, bool>& p) { return p.second; }) > 0);
     }
     
+    void EventSelection::buffer () {
+        DEBUG("Entering.");
+        DEBUG("  Buffering event for EventSelection '%s'.", name().c_str());
+
+	// Lock, such that no more modifications can be performed.
+	lock();
+
+	// Make sure that collection links have been cached.
+	if (not m_hasCachedCollections) { cacheCollections_(); }
+
+	// Make sure that the operations shared by all categories have been found.
+	if (not m_hasFoundSharedPrefix) { findSharedPrefix_(); }
+
+	// Start a new batch, if the previous one has been run.
+	if (m_batchRun) {
+	  m_nBuffered = 0;
+	  m_batchRun  = false;
+	}
+	const unsigned i = m_nBuffered++;
+
+	// Store the weight and an empty values cache for the event.
+	m_batchWeights.resize(m_nBuffered);
+	m_batchWeights[i] = weight_();
+	if (m_batchCaches.size() < m_nBuffered) { m_batchCaches.emplace_back(); }
+	m_batchCaches[i].clear();
+
+	// Copy the content shared by all categories, i.e. the input event and 
+	// the basic info.
+	prepareSharedEvent_();
+	if (m_batchInputs.size() < m_nBuffered) { m_batchInputs.emplace_back(); }
+	BatchInput& input = m_batchInputs[i];
+	input.objects.clear();
+	input.event.snapshot(m_basicInfoEvent, input.objects);
+
+	// Set up the event of each category as in 'prepareEvent_', with copies 
+	// of the linked collections. With operations shared by all categories, 
+	// only the event of the first category is set up, and forked at the 
+	// branch point (see 'runBatch').
+	m_batchCopies.clear();
+	for (const auto& category : this->categories()) {
+	    std::deque<BatchEvent>& batch = m_batchEvents[category];
+	    if (batch.size() < m_nBuffered) { batch.emplace_back(); }
+	    BatchEvent& entry = batch[i];
+	    entry.passes = false;
+	    if (m_sharedPrefix > 0 && category != this->m_categories.front()) { continue; }
+	    entry.event.clear();
+	    entry.event.setBase(&input.event);
+	    for (const CollectionLink& link : m_links[category]) {
+	        entry.event.addCollection(link.key, copyCollection_(link, input.objects));
+	    }
+	}
+
+	DEBUG("Exiting.");
+	return;
+    }
+    
+    bool EventSelection::runBatch () {
+        DEBUG("Entering.");
+        DEBUG("  Running EventSelection '%s' on batch of %d events.", name().c_str(), buffered());
+
+	const unsigned N = buffered();
+	if (N == 0) { return false; }
+
+	const std::vector<string>& categories = this->m_categories;
+	std::vector<TH1F*>& cutflows = m_runCutflows;
+	bool anyPassed = false;
+
+	// Run shared operations, as in 'run'.
+	std::vector<unsigned>& shared = m_batchSharedSurvivors;
+	unsigned sharedCuts = 1;
+	if (m_sharedPrefix > 0) {
+	    const string& first = categories.front();
+	    cutflows.clear();
+	    for (const auto& category : categories) {
+	        if (!this->hasCutflow(category)) { this->setupCutflow(category); }
+		cutflows.push_back(this->m_cutflow[category].get());
+	    }
+
+	    shared.clear();
+	    for (unsigned k = 0; k < N; k++) { shared.push_back(k); }
+	    for (TH1F* cutflow : cutflows) { fillBatchCutflow_(cutflow, 0, shared); }
+
+	    runBatchOperations_(first, 0, m_sharedPrefix, cutflows, shared, sharedCuts);
+
+	    // Fork the events at the branch point, before the first category 
+	    // moves on. Events not reaching it are copied as well, such that 
+	    // 'batchEvent' is valid for all of them.
+	    for (const auto& category : categories) {
+	        if (category == first) { continue; }
+		std::deque<BatchEvent>& batch = m_batchEvents[category];
+		for (unsigned k = 0; k < N; k++) { batch[k].event.assign(m_batchEvents[first][k].event); }
+	    }
+	}
+
+	// Loop categories (Nominal, ...)
+        for (const auto& category : categories) {
+	    DEBUG("  Category: '%s'", category.c_str());
+
+	    std::deque<BatchEvent>& batch = m_batchEvents[category];
+	    std::vector<unsigned>& survivors = m_batchSurvivors;
+	    unsigned iCut = sharedCuts;
+
+	    if (m_sharedPrefix > 0) {
+
+	        // Continue from the branch point.
+	        survivors = shared;
+
+	    } else {
+
+	        // Initialise cutflow histogram.
+                if (!this->hasCutflow(category)) { this->setupCutflow(category); }
+
+		// Fill first ('All') bin in cutflow
+		survivors.clear();
+		for (unsigned k = 0; k < N; k++) { survivors.push_back(k); }
+		fillBatchCutflow_(this->m_cutflow[category].get(), 0, survivors);
+	    }
+
+	    // Run selection.
+	    cutflows.assign(1, this->m_cutflow[category].get());
+	    runBatchOperations_(category, m_sharedPrefix, this->m_operations[category].size(), cutflows, survivors, iCut);
+
+	    // Store the per-event results.
+	    for (const unsigned& k : survivors) { batch[k].passes = true; }
+	    anyPassed |= !survivors.empty();
+
+	    // End the events.
+	    if (CutScheduler* scheduler = this->scheduler_(category, m_sharedPrefix)) {
+	        for (unsigned k = 0; k < N; k++) { scheduler->end(); }
+	    }
+	}
+
+	// Store that this selection has run.
+	m_batchRun = true;
+        this->m_hasRun = true;
+
+	DEBUG("Exiting.");
+	return anyPassed;
+    }
+    
     bool EventSelection::result () {
         assert( this->hasRun() ); // Necessary?
         assert( this->nCategories() == 1);
@@ -163,6 +294,50 @@ namespace AnalysisTools {
         return m_passes[category];
     }
     
+    bool EventSelection::result (const string& category, const unsigned& index) {
+        assert( m_batchRun );
+        assert( this->hasCategory(category) );
+        assert( index < m_nBuffered );
+        return m_batchEvents.at(category).at(index).passes;
+    }
+
+    bool EventSelection::batchResult (const unsigned& index) const {
+        assert( m_batchRun );
+        assert( index < m_nBuffered );
+	// As returned by 'run'.
+	if (m_batchEvents.empty()) { return true; }
+	for (const auto& category_batch : m_batchEvents) {
+	    if (category_batch.second.at(index).passes) { return true; }
+	}
+	return false;
+    }
+
+    bool EventSelection::dependsOn (ISelection* other) {
+        if (this->m_dependencies.count(other->name()) > 0) { return true; }
+        ObjectDefinition<TLorentzVector>* objdefTLV = dynamic_cast< ObjectDefinition<TLorentzVector>* >(other);
+        ObjectDefinition<PhysicsObject>*  objdefPO  = dynamic_cast< ObjectDefinition<PhysicsObject>* > (other);
+        if (!objdefTLV && !objdefPO) { return true; }
+
+        // Resolve the collection links, as in 'run'.
+        lock();
+        if (not m_hasCachedCollections) { cacheCollections_(); }
+        for (const auto& category : other->categories()) {
+	    const PhysicsObjects* output = (objdefTLV ? objdefTLV->result(category) : objdefPO->result(category));
+	    for (const auto& category_links : m_collectionLinks) {
+	        for (const auto& name_collection : category_links.second) {
+		    if (name_collection.second == output) { return true; }
+	        }
+	    }
+        }
+        return false;
+    }
+
+  const Event& EventSelection::batchEvent (const string& category, const unsigned& index) const {
+        assert( m_batchRun );
+        assert( index < m_nBuffered );
+        return m_batchEvents.at(category).at(index).event;
+    }
+    
     void EventSelection::print () const {
       INFO("  Configuration for event selection '%s':", this->name().c_str());
       for (const auto& cat_ops : this->m_operations) {
@@ -175,6 +350,265 @@ namespace AnalysisTools {
     }
     
     // Internal method(s).
+  float EventSelection::weight_ () const {
+    // Set correct MC weight, if possibly.
+    float weight = 1.;
+    if (this->m_weight) {
+      weight = *this->m_weight;
+    }
+    if (this->m_sum_weights && *this->m_sum_weights != 0) {
+      weight /= *this->m_sum_weights;
+    }
+    return weight;
+  }
+
+  void EventSelection::prepareSharedEvent_ () {
+    // Assign rather than construct, such that the event's storage is reused.
+    if (m_input) {
+      m_sharedEvent.assign(*m_input);
+    } else {
+      m_sharedEvent.clear();
+    }
+
+    // Bind all available auxiliary information, which is then read 
+    // directly from the user's variables. This is only done again if 
+    // any info has been added since.
+    bindBasicInfo_<unsigned>(m_basicInfoKeys[0]);
+    bindBasicInfo_<double>  (m_basicInfoKeys[1]);
+    bindBasicInfo_<float>   (m_basicInfoKeys[2]);
+    bindBasicInfo_<bool>    (m_basicInfoKeys[3]);
+    bindBasicInfo_<int>     (m_basicInfoKeys[4]);
+    m_basicInfoEvent.setBase(&m_sharedEvent);
+    return;
+  }
+
+  void EventSelection::prepareEvent_ (const string& category) {
+    // The event of each category only holds what differs from the shared 
+    // event, i.e. its collections and whatever its operations add.
+    Event& event = m_events[category];
+    event.clear();
+    event.setBase(&m_basicInfoEvent);
+
+    // Add all collections found in 'cacheCollections_'. Collections from 
+    // lazy object definitions are only produced once they are accessed.
+    for (const CollectionLink& link : m_links[category]) {
+      if (link.trigger) {
+	event.addCollection(link.key, link.trigger);
+      } else {
+	event.addCollection(link.key, link.collection);
+      }
+    }
+    return;
+  }
+
+  template<class T>
+  void EventSelection::bindBasicInfo_ (std::vector<InfoKey>& keys) {
+    const auto& container = this->infoContainer<T>();
+    if (keys.size() == container.size()) { return; }
+    keys.clear();
+    for (const auto& name_val : container) {
+      keys.push_back(Event::key(name_val.first));
+      m_basicInfoEvent.bindInfo(keys.back(), name_val.second);
+    }
+    return;
+  }
+
+  bool EventSelection::runOperations_ (const string& category, const unsigned& begin, const unsigned& end, const std::vector<TH1F*>& cutflows, const float& weight, unsigned& iCut) {
+    const OperationPtrs& ops = this->m_operations.at(category);
+    Event& event = m_events[category];
+
+    // Get the order in which to run the operations; the declared one, 
+    // unless cut reordering is enabled.
+    CutScheduler* scheduler = this->scheduler_(category, m_sharedPrefix);
+    const bool measuring = scheduler && scheduler->measuring();
+
+    // Loop operations.
+    for (unsigned j = begin; j < end; j++) {
+      const unsigned i = (scheduler ? scheduler->order()[j] : j);
+      IOperation* iop = ops[i].get();
+      DEBUG("    Operation %d/%d", j + 1, ops.size());
+      
+      const double start = (measuring ? schedulerTime() : 0.);
+      const bool passes = applyOperation_(category, i, event, weight);
+      if (measuring) { scheduler->record(i, 1, passes, schedulerTime() - start); }
+
+      // If event didn't pass, stop for this category.
+      DEBUG("      Storing whether the cut was passed (%s).", (passes ? "Yes" : "No"));
+      if (!passes) { return false; }
+      
+      // Fill the cutflow(s), and increment cut counter, but only if the
+      // current operation was in fact a cut with a cutflow bin.
+      if (iop->operationType() != OperationType::Cut || !static_cast< Cut<Event>* >(iop)->bookkeeping()) { continue; }
+      // Cuts with a cutflow bin are never reordered (see CutScheduler).
+      for (TH1F* cutflow : cutflows) { cutflow->Fill(iCut, weight); }
+      iCut++;
+    }
+    return true;
+  }
+
+  void EventSelection::runBatchOperations_ (const string& category, const unsigned& begin, const unsigned& end, const std::vector<TH1F*>& cutflows, std::vector<unsigned>& survivors, unsigned& iCut) {
+    const OperationPtrs& ops = this->m_operations.at(category);
+    std::deque<BatchEvent>& batch = m_batchEvents[category];
+
+    // The order in which to run the operations is kept fixed for the whole batch.
+    CutScheduler* scheduler = this->scheduler_(category, m_sharedPrefix);
+    const bool measuring = scheduler && scheduler->measuring();
+
+    // Loop operations, each over all surviving events.
+    for (unsigned j = begin; j < end && !survivors.empty(); j++) {
+      const unsigned i = (scheduler ? scheduler->order()[j] : j);
+      IOperation* iop = ops[i].get();
+
+      const double start = (measuring ? schedulerTime() : 0.);
+      const unsigned nIn = survivors.size();
+      unsigned nSurvivors = 0;
+      for (const unsigned& k : survivors) {
+
+	// Use the values cache of the event.
+	if (this->performCaching()) { this->valuesCache()->swap(m_batchCaches[k]); }
+	const bool passes = applyOperation_(category, i, batch[k].event, m_batchWeights[k]);
+	if (this->performCaching()) { this->valuesCache()->swap(m_batchCaches[k]); }
+
+	// Compact survivor list in-place.
+	if (passes) { survivors[nSurvivors++] = k; }
+      }
+      survivors.resize(nSurvivors);
+      if (measuring) { scheduler->record(i, nIn, nSurvivors, schedulerTime() - start); }
+
+      // Fill the cutflow(s) with the surviving events, and increment cut 
+      // counter, but only if the current operation was in fact a cut with
+      // a cutflow bin.
+      if (iop->operationType() != OperationType::Cut || !static_cast< Cut<Event>* >(iop)->bookkeeping()) { continue; }
+      for (TH1F* cutflow : cutflows) { fillBatchCutflow_(cutflow, iCut, survivors); }
+      iCut++;
+    }
+    return;
+  }
+
+  void EventSelection::fillBatchCutflow_ (TH1F* cutflow, const unsigned& iCut, const std::vector<unsigned>& events) const {
+    if (events.empty()) { return; }
+
+    // Sum the weights of the events, and their squares.
+    double sumw = 0., sumw2 = 0.;
+    bool weighted = false;
+    for (const unsigned& k : events) {
+      const double w = m_batchWeights[k];
+      sumw     += w;
+      sumw2    += w * w;
+      weighted |= (w != 1.);
+    }
+
+    // Update the cutflow as 'Fill(iCut, w)' would for each event.
+    const double x = iCut;
+    double stats[4];
+    if (weighted && cutflow->GetSumw2N() == 0) { cutflow->Sumw2(); }
+    cutflow->GetStats(stats); // Before changing the contents, from which the statistics of an empty histogram are computed.
+    const int bin = cutflow->GetXaxis()->FindFixBin(x);
+    cutflow->AddBinContent(bin, sumw);
+    if (cutflow->GetSumw2N() > 0) { cutflow->GetSumw2()->AddAt(cutflow->GetSumw2()->At(bin) + sumw2, bin); }
+    stats[0] += sumw;
+    stats[1] += sumw2;
+    stats[2] += sumw * x;
+    stats[3] += sumw * x * x;
+    cutflow->PutStats(stats);
+    cutflow->SetEntries(cutflow->GetEntries() + events.size());
+    return;
+  }
+
+  PhysicsObjects* EventSelection::copyCollection_ (const CollectionLink& link, std::list<PhysicsObjects>& storage) {
+    const PhysicsObjects* source = (link.trigger ? link.trigger() : link.collection);
+    for (const auto& source_copy : m_batchCopies) {
+      if (source_copy.first == source) { return source_copy.second; }
+    }
+    storage.emplace_back(*source);
+    for (PhysicsObject& object : storage.back()) { object.detach(); }
+    m_batchCopies.emplace_back(source, &storage.back());
+    return &storage.back();
+  }
+
+  bool EventSelection::applyOperation_ (const string& category, const unsigned& i, Event& event, const float& weight) {
+    IOperation* iop = this->m_operations.at(category)[i].get();
+
+    // Operations shared by all categories are only run on the first one 
+    // (see 'run'), and recorded in the copies in the other categories.
+    const bool shared = (i < m_sharedPrefix);
+    
+    // Cast IOperation to either Operation or Cut, in order to call
+    // 'apply' with the correct signature.
+    DEBUG("      Casting IOperation '%s'", iop->name().c_str());
+    bool passes = false;
+    if        (iop->operationType() == OperationType::Operation) {
+      Operation<Event>* op  = static_cast< Operation<Event>* >(iop);
+      if (shared) {
+	for (const auto& other : this->m_categories) {
+	  if (other == category) { continue; }
+	  static_cast< Operation<Event>* >(this->m_operations.at(other)[i].get())->replay(CutPosition::Pre, event, weight);
+	}
+      }
+      passes = op->apply(event, weight);
+      if (shared) {
+	for (const auto& other : this->m_categories) {
+	  if (other == category) { continue; }
+	  static_cast< Operation<Event>* >(this->m_operations.at(other)[i].get())->replay(CutPosition::Post, event, weight, passes);
+	}
+      }
+    } else if (iop->operationType() == OperationType::Cut) {
+      Cut<Event>*       cut = static_cast< Cut<Event>* >      (iop);
+      passes = cut->apply(event, weight);
+      if (shared) {
+	for (const auto& other : this->m_categories) {
+	  if (other == category) { continue; }
+	  static_cast< Cut<Event>* >(this->m_operations.at(other)[i].get())->replay(event, weight, *cut, passes);
+	}
+      }
+    } else {
+      WARNING("Operation could not be cast to any known type.");
+    }
+    return passes;
+  }
+
+  void EventSelection::findSharedPrefix_ () {
+    DEBUG("Entering.");
+    assert( locked() );
+    assert( m_hasCachedCollections );
+
+    m_sharedPrefix = 0;
+    m_hasFoundSharedPrefix = true;
+
+    const std::vector<string> categories = this->categories();
+    if (categories.size() < 2) { return; }
+    const string& first = categories.front();
+
+    // All categories must see the same event.
+    for (const auto& category : categories) {
+      if (m_collectionLinks[category] != m_collectionLinks[first]) { return; }
+    }
+
+    // Operations before the branch point are added to all categories (see 
+    // 'addCut' and 'addOperation'). Check that they are in fact copies of 
+    // the same operation, unmodified since (see IOperation::origin), such 
+    // that running them once gives the same result in all categories.
+    unsigned prefix = (this->m_branch >= 0 ? this->m_branch : this->m_operations[first].size());
+    for (const auto& category : categories) {
+      prefix = std::min(prefix, (unsigned) this->m_operations[category].size());
+    }
+    for (unsigned i = 0; i < prefix; i++) {
+      const IOperation* reference = this->m_operations[first][i].get();
+      bool shared = (reference->origin() != 0);
+      for (const auto& category : categories) {
+	shared &= (this->m_operations[category][i]->origin() == reference->origin());
+      }
+      if (!shared) {
+	prefix = i;
+	break;
+      }
+    }
+
+    m_sharedPrefix = prefix;
+    DEBUG("  Found %d operations shared by all categories.", m_sharedPrefix);
+    return;
+  }
+
   void EventSelection::cacheCollections_ () {
 
     DEBUG("Entering.");
@@ -253,11 +687,19 @@ namespace AnalysisTools {
 	      DEBUG(" ---- Got one! Looking for '%s'.", selectionCategory.c_str());
 	      m_collectionLinks[category][name] = objdef->result(selectionCategory);
 	      DEBUG(" ------ Storing results pointer:");
+	      if (objdef->lazy()) {
+		const std::string* objdefCategory = &std::get<2>(tuple);
+		m_collectionTriggers[category][name] = [objdef, objdefCategory] () { return objdef->demand(*objdefCategory); };
+	      }
 	      break;
 	    } else if (ObjectDefinition<PhysicsObject>* objdef = dynamic_cast<ObjectDefinition<PhysicsObject>*>(child) ) {
 	      DEBUG(" ---- Got one! Looking for '%s'.", selectionCategory.c_str());
 	      m_collectionLinks[category][name] = objdef->result(selectionCategory);
 	      DEBUG(" ------ Storing results pointer:");
+	      if (objdef->lazy()) {
+		const std::string* objdefCategory = &std::get<2>(tuple);
+		m_collectionTriggers[category][name] = [objdef, objdefCategory] () { return objdef->demand(*objdefCategory); };
+	      }
 	      break;
 	    }
 	  }
@@ -271,6 +713,21 @@ namespace AnalysisTools {
       }
     }
 
+    // Resolve the collection names to event keys.
+    for (const auto& category_links : m_collectionLinks) {
+      const auto& triggers = m_collectionTriggers[category_links.first];
+      std::vector<CollectionLink>& links = m_links[category_links.first];
+      links.clear();
+      for (const auto& name_pointer : category_links.second) {
+	CollectionLink link;
+	link.key        = Event::key(name_pointer.first);
+	link.collection = name_pointer.second;
+	auto it = triggers.find(name_pointer.first);
+	if (it != triggers.end()) { link.trigger = it->second; }
+	links.push_back(link);
+      }
+    }
+
     // Flag that collections have been cached.
     m_hasCachedCollections = true;
 
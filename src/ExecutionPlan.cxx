@@ -0,0 +1,88 @@
+#include "AnalysisTools/ExecutionPlan.h"
+
+namespace AnalysisTools {
+
+  // Set method(s).
+  template <class T>
+  void ExecutionPlan<T>::compile (ILocalised* parent,
+				  const std::vector< IPlotMacro* >& pre,
+				  const std::vector< IPlotMacro* >& post,
+				  TTree* preTree,
+				  TTree* postTree,
+				  const std::string& variable) {
+
+    // Resolve pointer to parent Selection-type instance, and its values cache.
+    m_parent = dynamic_cast<ISelection*>(parent);
+    m_cache  = m_parent ? m_parent->valuesCache() : nullptr;
+
+    // Split plotting macros by fill type.
+    compileStage_(m_pre,  pre,  preTree,  variable, false);
+    compileStage_(m_post, post, postTree, variable, true);
+
+    m_compiled = true;
+    return;
+  }
+
+
+  // High-level management method(s).
+  template <class T>
+  void ExecutionPlan<T>::addToCache (const CutPosition& pos, const T& obj, const float& w) {
+    assert( m_cache );
+    for (const Entry& entry : stage(pos).entries) {
+      if (!entry.cache) { continue; }
+      if (entry.weight) {
+	m_cache->add(entry.key, w);
+      } else {
+	m_cache->add(entry.key, obj, entry.object->function());
+      }
+    }
+    return;
+  }
+
+  template <class T>
+  void ExecutionPlan<T>::fillFromCache (const CutPosition& pos) {
+    assert( m_cache );
+    for (const Entry& entry : stage(pos).entries) {
+      entry.plot->fillDirectly(m_cache->get(entry.key));
+    }
+    return;
+  }
+
+
+  // Low-level management method(s).
+  template <class T>
+  void ExecutionPlan<T>::compileStage_ (Stage& stage, const std::vector< IPlotMacro* >& plots, TTree* tree, const std::string& variable, const bool& post) {
+    stage.weights.clear();
+    stage.objects.clear();
+    stage.values.clear();
+    stage.entries.clear();
+    stage.tree = tree;
+    if (tree) { stage.buffer.setTree(tree, plots); }
+
+    for (IPlotMacro* plot : plots) {
+      Entry entry;
+      entry.plot = plot;
+      entry.key  = plot->name();
+      if (entry.key == "weight") {
+	entry.weight = static_cast< PlotMacro1D<float>* >(plot);
+	stage.weights.push_back(entry.weight);
+      } else {
+	entry.object = static_cast< PlotMacro1D<T>* >(plot);
+	if (variable != "" && entry.key == variable) {
+	  stage.values.push_back(plot);
+	} else {
+	  stage.objects.push_back(entry.object);
+	}
+      }
+      // Post-cut weight and cut variable are already cached from the pre-cut stage.
+      entry.cache = !(post && (entry.key == "weight" || entry.key == "CutVariable"));
+      stage.entries.push_back(entry);
+    }
+    return;
+  }
+
+}
+
+template class AnalysisTools::ExecutionPlan<TLorentzVector>;
+template class AnalysisTools::ExecutionPlan<AnalysisTools::PhysicsObject>;
+template class AnalysisTools::ExecutionPlan<AnalysisTools::Event>;
@@ -0,0 +1,534 @@
+#include "AnalysisTools/Expression.h"
+
+// STL include(s).
+#include <cmath> /* std::abs, std::sqrt, std::log, std::exp, std::pow */
+#include <cctype> /* std::isspace, std::isdigit, std::isalpha, std::isalnum */
+#include <cstdlib> /* std::strtof */
+#include <algorithm> /* std::min, std::max */
+#include <type_traits> /* std::is_same */
+
+namespace AnalysisTools {
+
+  namespace {
+
+    // Kinematic loads, shared by all four-vector types.
+    template<class OpCode, class V>
+    inline float loadKinematics (const V& p, const OpCode& op) {
+      switch (op) {
+      case OpCode::Pt:  return p.Pt();
+      case OpCode::Eta: return p.Eta();
+      case OpCode::Phi: return p.Phi();
+      case OpCode::M:   return p.M();
+      case OpCode::E:   return p.E();
+      case OpCode::Px:  return p.Px();
+      case OpCode::Py:  return p.Py();
+      case OpCode::Pz:  return p.Pz();
+      default: break;
+      }
+      return 0.;
+    }
+
+    // Unary and binary operations, shared by the scalar and column evaluation.
+    template<class OpCode>
+    inline float unary (const OpCode& op, const float& x) {
+      switch (op) {
+      case OpCode::Neg:  return -x;
+      case OpCode::Not:  return (float) !x;
+      case OpCode::Abs:  return std::abs(x);
+      case OpCode::Sqrt: return std::sqrt(x);
+      case OpCode::Log:  return std::log(x);
+      case OpCode::Exp:  return std::exp(x);
+      default: break;
+      }
+      return x;
+    }
+
+    template<class OpCode>
+    inline float binary (const OpCode& op, const float& a, const float& b) {
+      switch (op) {
+      case OpCode::Add: return a + b;
+      case OpCode::Sub: return a - b;
+      case OpCode::Mul: return a * b;
+      case OpCode::Div: return a / b;
+      case OpCode::Pow: return std::pow(a, b);
+      case OpCode::Min: return std::min(a, b);
+      case OpCode::Max: return std::max(a, b);
+      case OpCode::Lt:  return (float) (a <  b);
+      case OpCode::Le:  return (float) (a <= b);
+      case OpCode::Gt:  return (float) (a >  b);
+      case OpCode::Ge:  return (float) (a >= b);
+      case OpCode::Eq:  return (float) (a == b);
+      case OpCode::Ne:  return (float) (a != b);
+      case OpCode::And: return (float) (a && b);
+      case OpCode::Or:  return (float) (a || b);
+      default: break;
+      }
+      return a;
+    }
+
+    // Apply 'f' element-wise over a whole column. Kept as a separate loop for each operation, such that the compiler can vectorise it.
+    template<class F>
+    inline void columnUnary (float* x, const unsigned& N, F f) {
+      for (unsigned i = 0; i < N; i++) { x[i] = f(x[i]); }
+    }
+
+    template<class F>
+    inline void columnBinary (float* a, const float* b, const unsigned& N, F f) {
+      for (unsigned i = 0; i < N; i++) { a[i] = f(a[i], b[i]); }
+    }
+
+  } // namespace
+
+
+  /// Constructor(s).
+  template<class T>
+  Expression<T>::Expression (const std::string& expression) :
+    m_expression(expression)
+  {
+    m_pos = 0;
+    parseOr_();
+    skipSpace_();
+    if (m_pos != m_expression.size()) {
+      ERROR("Unexpected '%s' in expression '%s'.", m_expression.substr(m_pos).c_str(), m_expression.c_str());
+    }
+
+    // Allocate scratch space once.
+    m_stack.resize(m_depth);
+    m_columns.resize(m_depth);
+
+    // Resolve info names up front, rather than while evaluating.
+    resolve();
+  }
+
+
+  /// High-level management method(s).
+  template<class T>
+  float Expression<T>::evaluate (const T& obj) const {
+    float* stack = m_stack.data();
+    unsigned n = 0;
+    for (const Instruction& ins : m_instructions) {
+      switch (ins.op) {
+      case OpCode::Constant:
+	stack[n++] = ins.value;
+	break;
+      case OpCode::Pt:   case OpCode::Eta: case OpCode::Phi: case OpCode::M:
+      case OpCode::E:    case OpCode::Px:  case OpCode::Py:  case OpCode::Pz:
+      case OpCode::Info: case OpCode::HasInfo: case OpCode::Num:
+	stack[n++] = load_(obj, ins);
+	break;
+      case OpCode::Neg:  case OpCode::Not: case OpCode::Abs:
+      case OpCode::Sqrt: case OpCode::Log: case OpCode::Exp:
+	stack[n - 1] = unary(ins.op, stack[n - 1]);
+	break;
+      default:
+	n--;
+	stack[n - 1] = binary(ins.op, stack[n - 1], stack[n]);
+	break;
+      }
+    }
+    assert( n == 1 );
+    return stack[0];
+  }
+
+  template<class T>
+  void Expression<T>::evaluate (const std::vector<T>& objects, std::vector<float>& values) const {
+    evaluateColumns_(objects.size(), [&objects](const unsigned& i) -> const T& { return objects[i]; }, values);
+    return;
+  }
+
+  template<class T>
+  void Expression<T>::evaluate (const std::vector<T>& objects, const std::vector<unsigned>& indices, std::vector<float>& values) const {
+    evaluateColumns_(indices.size(), [&objects, &indices](const unsigned& i) -> const T& { return objects[indices[i]]; }, values);
+    return;
+  }
+
+  template<class T>
+  template<class A>
+  void Expression<T>::evaluateColumns_ (const unsigned& N, const A& at, std::vector<float>& values) const {
+    for (std::vector<float>& column : m_columns) {
+      column.resize(N);
+    }
+
+    unsigned n = 0;
+    for (const Instruction& ins : m_instructions) {
+      switch (ins.op) {
+      case OpCode::Constant:
+	{
+	  float* x = m_columns[n++].data();
+	  for (unsigned i = 0; i < N; i++) { x[i] = ins.value; }
+	}
+	break;
+      case OpCode::Pt:   case OpCode::Eta: case OpCode::Phi: case OpCode::M:
+      case OpCode::E:    case OpCode::Px:  case OpCode::Py:  case OpCode::Pz:
+      case OpCode::Info: case OpCode::HasInfo: case OpCode::Num:
+	{
+	  float* x = m_columns[n++].data();
+	  for (unsigned i = 0; i < N; i++) { x[i] = load_(at(i), ins); }
+	}
+	break;
+      case OpCode::Neg:  columnUnary(m_columns[n - 1].data(), N, [](float x) { return -x; }); break;
+      case OpCode::Not:  columnUnary(m_columns[n - 1].data(), N, [](float x) { return (float) !x; }); break;
+      case OpCode::Abs:  columnUnary(m_columns[n - 1].data(), N, [](float x) { return std::abs(x); }); break;
+      case OpCode::Sqrt: columnUnary(m_columns[n - 1].data(), N, [](float x) { return std::sqrt(x); }); break;
+      case OpCode::Log:  columnUnary(m_columns[n - 1].data(), N, [](float x) { return std::log(x); }); break;
+      case OpCode::Exp:  columnUnary(m_columns[n - 1].data(), N, [](float x) { return std::exp(x); }); break;
+      default:
+	{
+	  n--;
+	  float*       a = m_columns[n - 1].data();
+	  const float* b = m_columns[n]    .data();
+	  switch (ins.op) {
+	  case OpCode::Add: columnBinary(a, b, N, [](float x, float y) { return x + y; }); break;
+	  case OpCode::Sub: columnBinary(a, b, N, [](float x, float y) { return x - y; }); break;
+	  case OpCode::Mul: columnBinary(a, b, N, [](float x, float y) { return x * y; }); break;
+	  case OpCode::Div: columnBinary(a, b, N, [](float x, float y) { return x / y; }); break;
+	  case OpCode::Lt:  columnBinary(a, b, N, [](float x, float y) { return (float) (x <  y); }); break;
+	  case OpCode::Le:  columnBinary(a, b, N, [](float x, float y) { return (float) (x <= y); }); break;
+	  case OpCode::Gt:  columnBinary(a, b, N, [](float x, float y) { return (float) (x >  y); }); break;
+	  case OpCode::Ge:  columnBinary(a, b, N, [](float x, float y) { return (float) (x >= y); }); break;
+	  case OpCode::And: columnBinary(a, b, N, [](float x, float y) { return (float) (x && y); }); break;
+	  case OpCode::Or:  columnBinary(a, b, N, [](float x, float y) { return (float) (x || y); }); break;
+	  default:
+	    for (unsigned i = 0; i < N; i++) { a[i] = binary(ins.op, a[i], b[i]); }
+	    break;
+	  }
+	}
+	break;
+      }
+    }
+    assert( n == 1 );
+    values.assign(m_columns[0].begin(), m_columns[0].end());
+    return;
+  }
+
+
+  /// Low-level management method(s).
+  // Parsing.
+  template<class T>
+  void Expression<T>::parseOr_ () {
+    parseAnd_();
+    while (accept_("||")) {
+      parseAnd_();
+      emit_(OpCode::Or);
+    }
+    return;
+  }
+
+  template<class T>
+  void Expression<T>::parseAnd_ () {
+    parseCompare_();
+    while (accept_("&&")) {
+      parseCompare_();
+      emit_(OpCode::And);
+    }
+    return;
+  }
+
+  template<class T>
+  void Expression<T>::parseCompare_ () {
+    parseSum_();
+    // Two-character operators must be tried first.
+    if      (accept_("<=")) { parseSum_(); emit_(OpCode::Le); }
+    else if (accept_(">=")) { parseSum_(); emit_(OpCode::Ge); }
+    else if (accept_("==")) { parseSum_(); emit_(OpCode::Eq); }
+    else if (accept_("!=")) { parseSum_(); emit_(OpCode::Ne); }
+    else if (accept_("<"))  { parseSum_(); emit_(OpCode::Lt); }
+    else if (accept_(">"))  { parseSum_(); emit_(OpCode::Gt); }
+    return;
+  }
+
+  template<class T>
+  void Expression<T>::parseSum_ () {
+    parseProduct_();
+    while (true) {
+      if      (accept_("+")) { parseProduct_(); emit_(OpCode::Add); }
+      else if (accept_("-")) { parseProduct_(); emit_(OpCode::Sub); }
+      else { break; }
+    }
+    return;
+  }
+
+  template<class T>
+  void Expression<T>::parseProduct_ () {
+    parseUnary_();
+    while (true) {
+      if      (accept_("*")) { parseUnary_(); emit_(OpCode::Mul); }
+      else if (accept_("/")) { parseUnary_(); emit_(OpCode::Div); }
+      else { break; }
+    }
+    return;
+  }
+
+  template<class T>
+  void Expression<T>::parseUnary_ () {
+    skipSpace_();
+    if (m_pos < m_expression.size() && m_expression[m_pos] == '!' && m_expression.compare(m_pos, 2, "!=") != 0) {
+      m_pos++;
+      parseUnary_();
+      emit_(OpCode::Not);
+    } else if (accept_("-")) {
+      parseUnary_();
+      emit_(OpCode::Neg);
+    } else {
+      parsePrimary_();
+    }
+    return;
+  }
+
+  template<class T>
+  void Expression<T>::parsePrimary_ () {
+    skipSpace_();
+    if (m_pos >= m_expression.size()) {
+      ERROR("Unexpected end of expression '%s'.", m_expression.c_str());
+    }
+
+    // Parenthesised sub-expression.
+    if (accept_("(")) {
+      parseOr_();
+      expect_(")");
+      return;
+    }
+
+    // Numeric literal.
+    const char c = m_expression[m_pos];
+    if (std::isdigit(c) || c == '.') {
+      const char* begin = m_expression.c_str() + m_pos;
+      char* end = nullptr;
+      const float value = std::strtof(begin, &end);
+      m_pos += end - begin;
+      emit_(OpCode::Constant, value);
+      return;
+    }
+
+    // Function call or variable.
+    if (!peekName_()) {
+      ERROR("Unexpected '%s' in expression '%s'.", m_expression.substr(m_pos).c_str(), m_expression.c_str());
+    }
+    const std::string name = readName_();
+    if (accept_("(")) {
+      parseCall_(name);
+      return;
+    }
+    if (!variable_(name)) {
+      ERROR("Unknown variable '%s' in expression '%s'.", name.c_str(), m_expression.c_str());
+    }
+    return;
+  }
+
+  template<class T>
+  void Expression<T>::parseCall_ (const std::string& function) {
+    // Functions taking a name as argument.
+    if (function == "info" || function == "hasInfo" || function == "num") {
+      skipSpace_();
+      const std::string name = (m_pos < m_expression.size() && (m_expression[m_pos] == '"' || m_expression[m_pos] == '\'')) ? readString_() : readName_();
+      expect_(")");
+      const OpCode op = (function == "info" ? OpCode::Info : (function == "hasInfo" ? OpCode::HasInfo : OpCode::Num));
+      // Only Event supports 'hasInfo' and 'num'; only PhysicsObject and Event support 'info'.
+      const bool supported = std::is_same<T, Event>::value || (std::is_same<T, PhysicsObject>::value && op == OpCode::Info);
+      if (!supported) {
+	ERROR("Function '%s' is not available for this object type, in expression '%s'.", function.c_str(), m_expression.c_str());
+      }
+      emit_(op, 0., nameIndex_(name));
+      return;
+    }
+
+    // Numeric functions.
+    unsigned nargs = 0;
+    OpCode op = OpCode::Constant;
+    if      (function == "abs")  { op = OpCode::Abs;  nargs = 1; }
+    else if (function == "sqrt") { op = OpCode::Sqrt; nargs = 1; }
+    else if (function == "log")  { op = OpCode::Log;  nargs = 1; }
+    else if (function == "exp")  { op = OpCode::Exp;  nargs = 1; }
+    else if (function == "min")  { op = OpCode::Min;  nargs = 2; }
+    else if (function == "max")  { op = OpCode::Max;  nargs = 2; }
+    else if (function == "pow")  { op = OpCode::Pow;  nargs = 2; }
+    else {
+      ERROR("Unknown function '%s' in expression '%s'.", function.c_str(), m_expression.c_str());
+    }
+    for (unsigned i = 0; i < nargs; i++) {
+      if (i > 0) { expect_(","); }
+      parseOr_();
+    }
+    expect_(")");
+    emit_(op);
+    return;
+  }
+
+  // Lexing.
+  template<class T>
+  void Expression<T>::skipSpace_ () {
+    while (m_pos < m_expression.size() && std::isspace(m_expression[m_pos])) { m_pos++; }
+    return;
+  }
+
+  template<class T>
+  bool Expression<T>::accept_ (const std::string& token) {
+    skipSpace_();
+    if (m_expression.compare(m_pos, token.size(), token) == 0) {
+      m_pos += token.size();
+      return true;
+    }
+    return false;
+  }
+
+  template<class T>
+  void Expression<T>::expect_ (const std::string& token) {
+    if (!accept_(token)) {
+      ERROR("Expected '%s' at position %d in expression '%s'.", token.c_str(), (int) m_pos, m_expression.c_str());
+    }
+    return;
+  }
+
+  template<class T>
+  bool Expression<T>::peekName_ () const {
+    return m_pos < m_expression.size() && (std::isalpha(m_expression[m_pos]) || m_expression[m_pos] == '_');
+  }
+
+  template<class T>
+  std::string Expression<T>::readName_ () {
+    skipSpace_();
+    if (!peekName_()) {
+      ERROR("Expected a name at position %d in expression '%s'.", (int) m_pos, m_expression.c_str());
+    }
+    const std::size_t begin = m_pos;
+    while (m_pos < m_expression.size() && (std::isalnum(m_expression[m_pos]) || m_expression[m_pos] == '_')) { m_pos++; }
+    return m_expression.substr(begin, m_pos - begin);
+  }
+
+  template<class T>
+  std::string Expression<T>::readString_ () {
+    const char quote = m_expression[m_pos++];
+    const std::size_t end = m_expression.find(quote, m_pos);
+    if (end == std::string::npos) {
+      ERROR("Unterminated string in expression '%s'.", m_expression.c_str());
+    }
+    const std::string output = m_expression.substr(m_pos, end - m_pos);
+    m_pos = end + 1;
+    return output;
+  }
+
+  // Code generation.
+  template<class T>
+  void Expression<T>::emit_ (const OpCode& op, const float& value, const unsigned& index) {
+    switch (op) {
+    case OpCode::Neg:  case OpCode::Not: case OpCode::Abs:
+    case OpCode::Sqrt: case OpCode::Log: case OpCode::Exp:
+      break;
+    case OpCode::Constant:
+    case OpCode::Pt:   case OpCode::Eta: case OpCode::Phi: case OpCode::M:
+    case OpCode::E:    case OpCode::Px:  case OpCode::Py:  case OpCode::Pz:
+    case OpCode::Info: case OpCode::HasInfo: case OpCode::Num:
+      m_size++;
+      break;
+    default:
+      m_size--;
+      break;
+    }
+    m_depth = std::max(m_depth, m_size);
+    m_instructions.push_back({ op, value, index });
+    return;
+  }
+
+  template<class T>
+  unsigned Expression<T>::nameIndex_ (const std::string& name) {
+    for (unsigned i = 0; i < m_names.size(); i++) {
+      if (m_names[i] == name) { return i; }
+    }
+    m_names.push_back(name);
+    return m_names.size() - 1;
+  }
+
+  template<class T>
+  bool Expression<T>::variable_ (const std::string& name) {
+    if      (name == "pt")               { emit_(OpCode::Pt);  }
+    else if (name == "eta")              { emit_(OpCode::Eta); }
+    else if (name == "phi")              { emit_(OpCode::Phi); }
+    else if (name == "m")                { emit_(OpCode::M);   }
+    else if (name == "e" || name == "E") { emit_(OpCode::E);   }
+    else if (name == "px")               { emit_(OpCode::Px);  }
+    else if (name == "py")               { emit_(OpCode::Py);  }
+    else if (name == "pz")               { emit_(OpCode::Pz);  }
+    else { return false; }
+    return true;
+  }
+
+  template<class T>
+  std::vector<InfoKey>& Expression<T>::keys_ (const InfoSchema* schema) const {
+    if (m_lastKeys < m_keys.size() && m_keys[m_lastKeys].schema == schema) { return m_keys[m_lastKeys].keys; }
+    for (m_lastKeys = 0; m_lastKeys < m_keys.size(); m_lastKeys++) {
+      if (m_keys[m_lastKeys].schema == schema) { return m_keys[m_lastKeys].keys; }
+    }
+    m_keys.push_back({ schema, std::vector<InfoKey>(m_names.size()) });
+    for (unsigned i = 0; i < m_names.size(); i++) {
+      schema->find(m_names[i], m_keys.back().keys[i]);
+    }
+    return m_keys.back().keys;
+  }
+
+  template<>
+  void Expression<TLorentzVector>::resolve (InfoSchema* /*schema*/) {
+    // No info on TLorentzVector.
+    return;
+  }
+
+  template<>
+  void Expression<PhysicsObject>::resolve (InfoSchema* schema) {
+    assert(schema);
+    std::vector<InfoKey>& keys = keys_(schema);
+    for (unsigned i = 0; i < m_names.size(); i++) {
+      keys[i] = schema->key(m_names[i]);
+    }
+    return;
+  }
+
+  template<>
+  void Expression<Event>::resolve (InfoSchema* /*schema*/) {
+    // All events share one schema.
+    std::vector<InfoKey>& keys = keys_(Event::schema());
+    for (unsigned i = 0; i < m_names.size(); i++) {
+      keys[i] = Event::key(m_names[i]);
+    }
+    return;
+  }
+
+  // Evaluation.
+  template<>
+  float Expression<TLorentzVector>::load_ (const TLorentzVector& obj, const Instruction& ins) const {
+    return loadKinematics(obj, ins.op);
+  }
+
+  template<>
+  float Expression<PhysicsObject>::load_ (const PhysicsObject& obj, const Instruction& ins) const {
+    if (ins.op == OpCode::Info) {
+      InfoKey& key = keys_(obj.schema())[ins.index];
+      // Names not in the schema when the keys were looked up may have been registered since; if not, this reports the missing info.
+      if (!key.schema && !obj.schema()->find(m_names[ins.index], key)) { return obj.info(m_names[ins.index]); }
+      return obj.info(key);
+    }
+    return loadKinematics(obj, ins.op);
+  }
+
+  template<>
+  bool Expression<Event>::variable_ (const std::string& name) {
+    // Bare names are read as event info.
+    emit_(OpCode::Info, 0., nameIndex_(name));
+    return true;
+  }
+
+  template<>
+  float Expression<Event>::load_ (const Event& obj, const Instruction& ins) const {
+    const InfoKey& key = m_keys.front().keys[ins.index];
+    switch (ins.op) {
+    case OpCode::Info:    return obj.info(key);
+    case OpCode::HasInfo: return obj.hasInfo(key);
+    case OpCode::Num:     return obj.collection(key).size();
+    default: break;
+    }
+    return 0.;
+  }
+
+} // namespace
+
+template class AnalysisTools::Expression<TLorentzVector>;
+template class AnalysisTools::Expression<AnalysisTools::PhysicsObject>;
+template class AnalysisTools::Expression<AnalysisTools::Event>;
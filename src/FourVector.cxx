@@ -0,0 +1,109 @@
+#include "AnalysisTools/FourVector.h"
+
+// STL include(s).
+#include <type_traits> /* std::is_trivially_copyable */
+
+namespace AnalysisTools {
+
+  static_assert(std::is_trivially_copyable<FourVector>::value, "FourVector must be trivially copyable.");
+
+  // Constructor(s).
+  FourVector::FourVector (const TLorentzVector& other) {
+    SetPxPyPzE(other.Px(), other.Py(), other.Pz(), other.E());
+  }
+
+
+  // Set method(s).
+  void FourVector::SetPtEtaPhiM (const double& pt, const double& eta, const double& phi, const double& m) {
+    m_pt  = std::abs(pt);
+    m_eta = eta;
+    m_phi = (std::abs(phi) <= M_PI ? phi : std::atan2(std::sin(phi), std::cos(phi)));
+    m_m   = m;
+    return;
+  }
+
+  void FourVector::SetPtEtaPhiE (const double& pt, const double& eta, const double& phi, const double& e) {
+    const double p  = std::abs(pt) * std::cosh(eta);
+    const double m2 = e * e - p * p;
+    SetPtEtaPhiM(pt, eta, phi, (m2 < 0 ? -std::sqrt(-m2) : std::sqrt(m2)));
+    return;
+  }
+
+  void FourVector::SetPxPyPzE (const double& px, const double& py, const double& pz, const double& e) {
+    const double p  = std::sqrt(px * px + py * py + pz * pz);
+    const double m2 = e * e - p * p;
+    SetXYZM(px, py, pz, (m2 < 0 ? -std::sqrt(-m2) : std::sqrt(m2)));
+    return;
+  }
+
+  void FourVector::SetXYZM (const double& x, const double& y, const double& z, const double& m) {
+    // Same conventions as TVector3::PseudoRapidity and TVector3::Phi, except along the beam axis.
+    const double p = std::sqrt(x * x + y * y + z * z);
+    const double cosTheta = (p == 0 ? 1. : z / p);
+    // Vectors (almost) along the beam axis are given a pt of at least 2^-64 |z|, rather than an infinite eta, such that pz is kept, and the derived components stay finite.
+    const double pt = std::max(std::sqrt(x * x + y * y), std::ldexp(std::abs(z), -64));
+    double eta;
+    if (cosTheta * cosTheta < 1) {
+      eta = -0.5 * std::log((1. - cosTheta) / (1. + cosTheta));
+    } else if (z == 0) {
+      eta = 0;
+    } else {
+      eta = std::asinh(z / pt);
+    }
+    m_pt  = pt;
+    m_eta = eta;
+    m_phi = (x == 0 && y == 0 ? 0. : std::atan2(y, x));
+    m_m   = m;
+    return;
+  }
+
+
+  // Get method(s).
+  double FourVector::Rapidity () const {
+    const double e  = E();
+    const double pz = Pz();
+    return 0.5 * std::log((e + pz) / (e - pz));
+  }
+
+  TLorentzVector FourVector::lorentzVector () const {
+    TLorentzVector output;
+    output.SetPtEtaPhiM(m_pt, m_eta, m_phi, m_m);
+    return output;
+  }
+
+
+  // Operator(s).
+  FourVector FourVector::operator+ (const FourVector& other) const {
+    FourVector output (*this);
+    output += other;
+    return output;
+  }
+
+  FourVector& FourVector::operator+= (const FourVector& other) {
+    SetPxPyPzE(Px() + other.Px(), Py() + other.Py(), Pz() + other.Pz(), E() + other.E());
+    return *this;
+  }
+
+  FourVector FourVector::operator- (const FourVector& other) const {
+    FourVector output (*this);
+    output -= other;
+    return output;
+  }
+
+  FourVector& FourVector::operator-= (const FourVector& other) {
+    SetPxPyPzE(Px() - other.Px(), Py() - other.Py(), Pz() - other.Pz(), E() - other.E());
+    return *this;
+  }
+
+  FourVector& FourVector::operator*= (const double& a) {
+    if (a >= 0) {
+      // Direction is unchanged.
+      m_pt *= a;
+      m_m  *= a;
+    } else {
+      SetPxPyPzE(a * Px(), a * Py(), a * Pz(), a * E());
+    }
+    return *this;
+  }
+
+}
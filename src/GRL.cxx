@@ -33,7 +33,7 @@ namespace AnalysisTools {
                 int commapos = value.find(",");
                 string Start = value.substr(0, commapos);
                 string End   = value.substr(commapos + 1, value.size() - commapos - 1);
-                m_goodRuns[run].push_back(Range(std::stoi(Start), std::stoi(End)));
+                m_goodRuns[run].add(Range(std::stoi(Start), std::stoi(End)));
             }
         }
 
@@ -50,21 +50,11 @@ namespace AnalysisTools {
     
     // High-level management method(s).
     bool GRL::contains (const int& run, const int& LB) const {
-        bool isGood = false;
         assert(m_hasXML);
-        if (run > -1) {
-            if (m_goodRuns.count(run)) {
-                for (Range goodRun : m_goodRuns.at(run)) {
-                    isGood |= goodRun.contains(LB);
-                    if (isGood) { break; }
-                }
-            } else {
-                isGood = false;
-            }
-        } else {
-            isGood = false;
-        }
-        return isGood;
+        if (run < 0) { return false; }
+        auto it = m_goodRuns.find(run);
+        if (it == m_goodRuns.end()) { return false; }
+        return it->second.contains(LB);
     }
 
     
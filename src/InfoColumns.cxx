@@ -0,0 +1,39 @@
+#include "AnalysisTools/InfoColumns.h"
+
+// STL include(s).
+#include <type_traits> /* std::is_same */
+
+namespace AnalysisTools {
+
+  // Set method(s).
+  template <class T>
+  void InfoColumns::bind (const InfoKey& key, const std::vector<T>* address) {
+    assert( address );
+    assert( key.schema == m_schema );
+    if (key.slot >= m_columns.size()) {
+      m_columns.resize(key.slot + 1);
+    }
+    Column& column = m_columns[key.slot];
+    if (column.type == None) { m_size++; }
+    column.address = address;
+    if      (std::is_same<T, double>::value) { column.type = Double; }
+    else if (std::is_same<T, float> ::value) { column.type = Float; }
+    else if (std::is_same<T, bool>  ::value) { column.type = Bool; }
+    else                                     { column.type = Int; }
+    return;
+  }
+
+  void InfoColumns::clear () {
+    m_columns.clear();
+    m_size = 0;
+    return;
+  }
+
+
+  // Explicitly instantiate template method(s).
+  template void InfoColumns::bind<double> (const InfoKey& key, const std::vector<double>* address);
+  template void InfoColumns::bind<float>  (const InfoKey& key, const std::vector<float>*  address);
+  template void InfoColumns::bind<bool>   (const InfoKey& key, const std::vector<bool>*   address);
+  template void InfoColumns::bind<int>    (const InfoKey& key, const std::vector<int>*    address);
+
+}
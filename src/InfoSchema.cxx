@@ -0,0 +1,46 @@
+#include "AnalysisTools/InfoSchema.h"
+
+namespace AnalysisTools {
+
+  /// Get method(s).
+  InfoKey InfoSchema::key (const std::string& name) {
+    InfoKey output;
+    if (find(name, output)) { return output; }
+
+    std::lock_guard<std::mutex> lock (m_mutex);
+    if (find(name, output)) { return output; } // Registered by another thread in the meantime.
+
+    // Copy the current table, add 'name', and publish the copy.
+    std::unique_ptr<Table> table (new Table(*m_table.load(std::memory_order_acquire)));
+    output.schema = this;
+    output.slot = table->names.size();
+    table->slots[name] = output.slot;
+    table->names.push_back(name);
+    m_table.store(table.get(), std::memory_order_release);
+    m_tables.emplace_back(std::move(table));
+    return output;
+  }
+
+  bool InfoSchema::find (const std::string& name, InfoKey& key) const {
+    const Table* table = m_table.load(std::memory_order_acquire);
+    auto it = table->slots.find(name);
+    if (it == table->slots.end()) { return false; }
+    key.schema = this;
+    key.slot   = it->second;
+    return true;
+  }
+
+  std::string InfoSchema::name (const unsigned& slot) const {
+    return m_table.load(std::memory_order_acquire)->names.at(slot);
+  }
+
+  unsigned InfoSchema::size () const {
+    return m_table.load(std::memory_order_acquire)->names.size();
+  }
+
+  InfoSchema* InfoSchema::global () {
+    static InfoSchema s_global;
+    return &s_global;
+  }
+
+}
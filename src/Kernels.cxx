@@ -0,0 +1,134 @@
+#include "AnalysisTools/Kernels.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define AnalysisTools_Kernels_AVX2
+#include <immintrin.h>
+#endif
+
+namespace AnalysisTools {
+
+  namespace {
+
+    // Runtime switch.
+    bool s_vectorisedKernels = true;
+
+    bool cpuSupportsAVX2 () {
+#ifdef AnalysisTools_Kernels_AVX2
+      static const bool supported = __builtin_cpu_supports("avx2");
+      return supported;
+#else
+      return false;
+#endif
+    }
+
+
+    // Scalar implementation(s).
+    void scalarRanges (const float* values, const unsigned& begin, const unsigned& end, const RangeSet& ranges, unsigned char* mask) {
+      if (ranges.empty()) {
+	for (unsigned k = begin; k < end; k++) {
+	  mask[k] = (bool) values[k];
+	}
+      } else {
+	ranges.contains(values + begin, end - begin, mask + begin);
+      }
+      return;
+    }
+
+
+    // Vectorised implementation(s).
+#ifdef AnalysisTools_Kernels_AVX2
+    __attribute__((target("avx2")))
+    void avx2Ranges (const float* values, const unsigned& N, const RangeSet& ranges, unsigned char* mask) {
+      const __m256 zero = _mm256_setzero_ps();
+      unsigned k = 0;
+      for (; k + 8 <= N; k += 8) {
+	const __m256 v = _mm256_loadu_ps(values + k);
+	__m256 passes;
+	if (ranges.size()) {
+	  passes = zero;
+	  for (unsigned i = 0; i < ranges.size(); i++) {
+	    // Ordered comparisons, such that NaN fails, as in RangeSet::contains.
+	    const __m256 above = _mm256_cmp_ps(v, _mm256_set1_ps(ranges.down(i)), _CMP_GE_OQ);
+	    const __m256 below = _mm256_cmp_ps(v, _mm256_set1_ps(ranges.up(i)),   _CMP_LE_OQ);
+	    passes = _mm256_or_ps(passes, _mm256_and_ps(above, below));
+	  }
+	} else {
+	  // Unordered comparison, such that NaN passes, as for a cast to bool.
+	  passes = _mm256_cmp_ps(v, zero, _CMP_NEQ_UQ);
+	}
+	const int bits = _mm256_movemask_ps(passes);
+	for (unsigned j = 0; j < 8; j++) {
+	  mask[k + j] = (bits >> j) & 1;
+	}
+      }
+      scalarRanges(values, k, N, ranges, mask);
+      return;
+    }
+#endif
+
+  } // namespace
+
+
+  // Runtime switch.
+  void setVectorisedKernels (const bool& use) {
+    s_vectorisedKernels = use;
+    return;
+  }
+
+  bool vectorisedKernels () {
+    return s_vectorisedKernels && cpuSupportsAVX2();
+  }
+
+
+  // Cut variable kernel(s).
+  void kernelPt (const PhysicsObjects& objects, const std::vector<unsigned>& indices, std::vector<float>& values) {
+    values.resize(indices.size());
+    for (unsigned k = 0; k < indices.size(); k++) {
+      values[k] = objects[indices[k]].Pt();
+    }
+    return;
+  }
+
+  void kernelEta (const PhysicsObjects& objects, const std::vector<unsigned>& indices, std::vector<float>& values) {
+    values.resize(indices.size());
+    for (unsigned k = 0; k < indices.size(); k++) {
+      values[k] = objects[indices[k]].Eta();
+    }
+    return;
+  }
+
+  void kernelM (const PhysicsObjects& objects, const std::vector<unsigned>& indices, std::vector<float>& values) {
+    values.resize(indices.size());
+    for (unsigned k = 0; k < indices.size(); k++) {
+      values[k] = objects[indices[k]].M();
+    }
+    return;
+  }
+
+  void kernelInfo (const PhysicsObjects& objects, const std::vector<unsigned>& indices, const std::string& name, const float& scale, std::vector<float>& values) {
+    values.resize(indices.size());
+    InfoKey key;
+    for (unsigned k = 0; k < indices.size(); k++) {
+      const PhysicsObject& p = objects[indices[k]];
+      if (key.schema != p.schema() && !p.schema()->find(name, key)) { values[k] = p.info(name) * scale; continue; }
+      values[k] = p.info(key) * scale;
+    }
+    return;
+  }
+
+
+  // Range kernel(s).
+  void kernelRanges (const std::vector<float>& values, const RangeSet& ranges, std::vector<unsigned char>& mask) {
+    mask.resize(values.size());
+#ifdef AnalysisTools_Kernels_AVX2
+    // For many intervals, the binary search in RangeSet is cheaper than testing all of them.
+    if (vectorisedKernels() && ranges.size() <= RangeSet::s_maxBranchless) {
+      avx2Ranges(values.data(), values.size(), ranges, mask.data());
+      return;
+    }
+#endif
+    scalarRanges(values.data(), 0, values.size(), ranges, mask.data());
+    return;
+  }
+
+}
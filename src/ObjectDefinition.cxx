@@ -8,6 +8,15 @@ namespace AnalysisTools {
         m_input = input;
         return;
     }
+
+    template <class T>
+    void ObjectDefinition<T>::setRequiredMultiplicity (const unsigned& min, const unsigned& max) {
+        assert( !this->locked() );
+        assert( min <= max );
+        m_minMultiplicity = min;
+        m_maxMultiplicity = max;
+        return;
+    }
     
     
     // Get method(s).
@@ -27,12 +36,17 @@ namespace AnalysisTools {
         /* *
          * Check that input- and info containers have same length.
          */
+
+        // Make sure that the input has been produced, if by a lazy object definition.
+        if (!m_hasFoundUpstream) { findUpstream_(); }
+        if (m_upstream) { m_upstream(); }
         for (const auto& category : this->m_categories) {
             m_candidates[category].clear();
+            m_passes[category] = (m_minMultiplicity == 0);
         }
         
-        // * Set up PhysicsObject candidates. [Within a private 'init' function?]
-	prepareCandidates_();
+        // * Set up the PhysicsObject candidates, shared by all categories.
+	const PhysicsObjects* pool = preparePool_();
 
         float weight = 1.;
         if (this->m_weight) {
@@ -44,44 +58,97 @@ namespace AnalysisTools {
         
         // * Run selection.
         for (const auto& category : this->m_categories) {
-            if (!m_candidates[category].size()) { continue; }
+            if (!pool->size()) { continue; }
             if (!this->hasCutflow(category)) { this->setupCutflow(category); }
+
+            // Each category keeps track of its surviving candidates by their 
+            // indices in the shared pool. Only if an operation is to modify 
+            // the candidates is a copy made, for this category alone.
+            PhysicsObjects&       candidates = this->m_candidates[category];
+            const PhysicsObjects* objects    = pool;
+            vector<unsigned>&     survivors  = this->m_survivors[category];
+            survivors.resize(pool->size());
+            std::iota(survivors.begin(), survivors.end(), 0);
+
+            // Get the order in which to run the operations; the declared one, 
+            // unless cut reordering is enabled.
+            const OperationPtrs& ops = this->m_operations.at(category);
+            CutScheduler* scheduler = this->scheduler_(category);
+            const bool measuring = scheduler && scheduler->measuring();
+
             unsigned int iCut = 0;
-            this->m_cutflow[category]->Fill(iCut++, this->m_candidates[category].size() * weight);
-            for (IOperation* iop : this->operations(category)) { 
+            this->m_cutflow[category]->Fill(iCut++, survivors.size() * weight);
+            for (unsigned j = 0; j < ops.size(); j++) {
+                const unsigned i = (scheduler ? scheduler->order()[j] : j);
+                IOperation* iop = ops[i].get();
                 // [Make use of branching?]
                 
-                // Loop candidates.
-                for (unsigned i = this->m_candidates[category].size(); i --> 0; ) {
+                const unsigned nIn   = survivors.size();
+                const double   start = (measuring ? schedulerTime() : 0.);
+		if (iop->operationType() == OperationType::Cut) {
+		  // Let the cut loop the candidates itself, such that the cut 
+		  // function can be inlined for statically-typed cuts.
+		  Cut<PhysicsObject>* cut = static_cast< Cut<PhysicsObject>* >(iop);
+		  cut->apply(*objects, survivors, weight);
+		} else {
+		  // Make a copy of the surviving candidates, to be modified.
+		  if (objects == pool) {
+		    materialise_(*pool, survivors, candidates);
+		    objects = &candidates;
+		  }
+
+		  // Loop surviving candidates.
+		  unsigned nFailed = 0;
+		  for (unsigned k = survivors.size(); k --> 0; ) {
                     bool passes = false;
-		    if        (iop->operationType() == OperationType::Operation) {
+		    if (iop->operationType() == OperationType::Operation) {
 		      Operation<PhysicsObject>* op  = static_cast< Operation<PhysicsObject>* >(iop);
-		      passes = op->apply(this->m_candidates[category].at(i), weight);
-                    } else if (iop->operationType() == OperationType::Cut) {
-		      Cut<PhysicsObject>*       cut = static_cast< Cut<PhysicsObject>* >(iop);
-		      passes = cut->apply(this->m_candidates[category].at(i), weight);
+		      passes = op->apply(candidates[survivors[k]], weight);
                     } else {
 		      WARNING("Operation could not be cast to any known type.");
                     }
                     
                     if (!passes) {
-                        this->m_candidates[category].erase(this->m_candidates[category].begin() + i);
+		      survivors[k] = candidates.size();
+		      nFailed++;
                     }
+		  }
+		  if (nFailed) {
+		    survivors.erase(std::remove(survivors.begin(), survivors.end(), (unsigned) candidates.size()), survivors.end());
+		  }
                 }
+                if (measuring) { scheduler->record(i, nIn, survivors.size(), schedulerTime() - start); }
 
-                if (iop->operationType() != OperationType::Cut) { continue; }
-                this->m_cutflow[category]->Fill(iCut++, this->m_candidates[category].size() * weight);
+                if (iop->operationType() != OperationType::Cut || !static_cast< Cut<PhysicsObject>* >(iop)->bookkeeping()) { continue; }
+                // Cuts with a cutflow bin are never reordered (see CutScheduler).
+                this->m_cutflow[category]->Fill(iCut++, survivors.size() * weight);
+            }
+            if (scheduler) { scheduler->end(); }
+
+            // Store the surviving candidates, once.
+            if (objects == pool) {
+                materialise_(*pool, survivors, candidates);
+            } else if (survivors.size() < candidates.size()) {
+                for (unsigned k = 0; k < survivors.size(); k++) {
+		  if (survivors[k] != k) { candidates[k] = std::move(candidates[survivors[k]]); }
+                }
+                candidates.erase(candidates.begin() + survivors.size(), candidates.end());
             }
 
+            const unsigned multiplicity = candidates.size();
+            m_passes[category] = (multiplicity >= m_minMultiplicity && multiplicity <= m_maxMultiplicity);
+
 	    DEBUG("Number of candidates in '%s' after full selection: %d", this->name().c_str(), this->m_candidates[category].size());
 	    //std::cout << " [" << &this->m_candidates[category] << "]" << std::endl;
         }
 
-        this->m_hasRun = true;
+        this->m_hasRun  = true;
+        this->m_current = true;
 
 	DEBUG("Exiting.");
 
-        return true; /* Always true for ObjectDefinition (i.e. cannot break the analysis pipeline). */
+        /* Always true for ObjectDefinition (i.e. cannot break the analysis pipeline), unless a required multiplicity has been set. */
+        return m_passes.size() == 0 || std::count_if(m_passes.begin(), m_passes.end(), [](const pair<string, bool>& p) { return p.second; }) > 0;
     }
   
     template <class T>
@@ -101,6 +168,40 @@ namespace AnalysisTools {
         return &this->m_candidates[category];
     }
     
+    template <class T>
+    PhysicsObjects* const ObjectDefinition<T>::demand (const string& category) {
+        if (!m_current) { run(); }
+        return result(category);
+    }
+
+    template <class T>
+    void ObjectDefinition<T>::invalidate () {
+        // Drop the results of the previous event, which may be drawn from 
+        // the event arena (see EventArena), rather than keep them until 
+        // next demanded.
+        m_current = false;
+        for (auto& category_candidates : this->m_candidates) {
+	    category_candidates.second.clear();
+        }
+        return;
+    }
+    
+    template <class T>
+    bool ObjectDefinition<T>::dependsOn (ISelection* other) {
+        // Object definitions only depend on other object definitions, if 
+        // these produce the input collection or have been declared as 
+        // dependencies.
+        if (this->m_dependencies.count(other->name()) > 0) { return true; }
+        ObjectDefinition<TLorentzVector>* objdefTLV = dynamic_cast< ObjectDefinition<TLorentzVector>* >(other);
+        ObjectDefinition<PhysicsObject>*  objdefPO  = dynamic_cast< ObjectDefinition<PhysicsObject>* > (other);
+        if (!objdefTLV && !objdefPO) { return true; }
+        for (const auto& category : other->categories()) {
+	    const void* output = (objdefTLV ? objdefTLV->result(category) : objdefPO->result(category));
+	    if (output == (const void*) m_input) { return true; }
+        }
+        return false;
+    }
+    
     template <class T>
     void ObjectDefinition<T>::print () const {
       INFO("  Configuration for object definition '%s':", this->name().c_str());
@@ -115,38 +216,85 @@ namespace AnalysisTools {
 
     // Low-level management method(s).
     // ...
-  template <>
-  void ObjectDefinition<TLorentzVector>::prepareCandidates_ () {
-    for (unsigned i = 0; i < this->m_input->size(); i++) {
-      for (const auto& category : this->m_categories) {
-	PhysicsObject p ((TLorentzVector) this->m_input->at(i));
-	for (const auto& name_val : this->infoContainer<double>()) {
-	  p.addInfo(name_val.first, (double) name_val.second->at(i));
-	}
-	for (const auto& name_val : this->infoContainer<float>()) {
-	  p.addInfo(name_val.first, (double) name_val.second->at(i));
-	}
-	for (const auto& name_val : this->infoContainer<bool>()) {
-	  p.addInfo(name_val.first, (double) name_val.second->at(i));
-	}
-	for (const auto& name_val : this->infoContainer<int>()) {
-	  p.addInfo(name_val.first, (double) name_val.second->at(i));
+  template <class T>
+  void ObjectDefinition<T>::findUpstream_ () {
+    m_hasFoundUpstream = true;
+    ILocalised* parent = this->parent();
+    if (!parent) { return; }
+
+    // Loop through the preceding children of the parent analysis.
+    for (const std::pair<ILocalised*, string>& child_category : parent->children()) {
+      ILocalised* child = child_category.first;
+      if (child == (ILocalised*) this) { break; }
+
+      ObjectDefinition<TLorentzVector>* objdefTLV = dynamic_cast< ObjectDefinition<TLorentzVector>* >(child);
+      ObjectDefinition<PhysicsObject>*  objdefPO  = dynamic_cast< ObjectDefinition<PhysicsObject>* > (child);
+      ISelection* objdef = (objdefTLV ? (ISelection*) objdefTLV : (ISelection*) objdefPO);
+      if (!objdef || !objdef->lazy()) { continue; }
+
+      for (const auto& category : objdef->categories()) {
+	const void* output = (objdefTLV ? objdefTLV->result(category) : objdefPO->result(category));
+	if (output != (const void*) m_input) { continue; }
+	DEBUG("Input of '%s' is produced on demand by '%s/%s'.", this->name().c_str(), child->name().c_str(), category.c_str());
+	if (objdefTLV) {
+	  m_upstream = [objdefTLV, category] () { objdefTLV->demand(category); };
+	} else {
+	  m_upstream = [objdefPO,  category] () { objdefPO ->demand(category); };
 	}
-	
-	m_candidates[category].emplace_back(p);
+	return;
       }
     }
     return;
   }
 
-  template <>
-  void ObjectDefinition<PhysicsObject>::prepareCandidates_ () {
-    for (const auto& category : this->m_categories) {
-      m_candidates[category] = *this->m_input;
+  template <class T>
+  void ObjectDefinition<T>::materialise_ (const PhysicsObjects& pool, vector<unsigned>& survivors, PhysicsObjects& candidates) {
+    candidates.clear();
+    candidates.reserve(survivors.size());
+    for (const unsigned& i : survivors) {
+      candidates.push_back(pool[i]);
+    }
+    std::iota(survivors.begin(), survivors.end(), 0);
+    return;
+  }
+
+  template <class T>
+  template <class U>
+  void ObjectDefinition<T>::bindColumns_ () {
+    for (const auto& name_val : this->infoContainer<U>()) {
+      m_columns.bind(m_columns.schema()->key(name_val.first), name_val.second);
     }
     return;
   }
 
+  template <>
+  const PhysicsObjects* ObjectDefinition<TLorentzVector>::preparePool_ () {
+    // Bind the info containers as columns, which the candidates read in 
+    // place. This is only done again if any info has been added since.
+    const unsigned nInfo = this->infoContainer<double>().size() + this->infoContainer<float>().size() + this->infoContainer<bool>().size() + this->infoContainer<int>().size();
+    if (m_columns.size() != nInfo) {
+      m_columns.clear();
+      bindColumns_<double>();
+      bindColumns_<float>();
+      bindColumns_<bool>();
+      bindColumns_<int>();
+    }
+
+    m_pool.clear();
+    m_pool.reserve(this->m_input->size());
+    for (unsigned i = 0; i < this->m_input->size(); i++) {
+      m_pool.emplace_back(this->m_input->at(i));
+      m_pool.back().setColumns(&m_columns, i);
+    }
+    return &m_pool;
+  }
+
+  template <>
+  const PhysicsObjects* ObjectDefinition<PhysicsObject>::preparePool_ () {
+    // The input collection can be shared as-is.
+    return this->m_input;
+  }
+
 
 }
 
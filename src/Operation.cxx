@@ -6,12 +6,14 @@ namespace AnalysisTools {
   template <class T>
   void Operation<T>::setFunction (const std::function< float(T&) >& f) {
     m_function = f;
+    this->m_origin = 0;
     return;
   }
   
   template <class T> // @asogaard: Move to Localised? (clearChildren)
   void Operation<T>::clearPlots () {
     m_plots.clear();
+    m_plan.invalidate();
     return;
   }
   
@@ -35,6 +37,7 @@ namespace AnalysisTools {
 	cout << "<Operation<T>::addPlot> Doesn't recognise template argument of plot '" << plot.name() << "'." << endl;
       }
     }
+    m_plan.invalidate();
     return;
   }
   
@@ -70,57 +73,55 @@ namespace AnalysisTools {
   bool Operation<T>::apply (T& obj, const float& w) {
     
     assert(m_function);
-    if (!m_initialised) { init(); }
+    if (!m_initialised)     { init(); }
+    if (!m_plan.compiled()) { compile_(); }
     
     // * Pre-cut distributions.
-    for (IPlotMacro* plot : plots(CutPosition::Pre)) {
-      if (plot->name() == "weight") {
-	((PlotMacro1D<float>*) plot)->fill(w);
-      } else {
-	((PlotMacro1D<T>*) plot)->fill(obj);
-      }
-    }
+    m_plan.fill(CutPosition::Pre, obj, w);
     
     // * Selection.
-    bool passes = false;
     float val = m_function(obj);
-    if (m_ranges.size()) {
-      for (const Range& range : m_ranges) {
-	passes |= range.contains(val);
-	if (passes) { break; }
-      }
-    } else {
-      passes = (bool) val;
-    }
+    const bool passes = m_ranges.empty() ? (bool) val : m_ranges.contains(val);
     
     // * Post-cut distributions.
     if (passes) {
-      for (IPlotMacro* plot : plots(CutPosition::Post)) {
-	if (plot->name() == "weight") {
-	  ((PlotMacro1D<float>*) plot)->fill(w);
-	} else {
-	  ((PlotMacro1D<T>*) plot)->fill(obj);
-	}
-      }
+      m_plan.fill(CutPosition::Post, obj, w);
     }
 
     // Only fill trees if there are trees to fill.
-    if (m_trees.size() > 0) {
-      m_trees[CutPosition::Pre]->Fill();
-      if (passes) {
-	m_trees[CutPosition::Post]->Fill();
-      }
-    }
+    m_plan.fillTrees(passes);
 
     return passes;
   }
+
+  template <class T>
+  void Operation<T>::replay (const CutPosition& pos, const T& obj, const float& w, const bool& passes) {
+    if (!m_initialised)     { init(); }
+    if (!m_plan.compiled()) { compile_(); }
+
+    if (pos == CutPosition::Pre) {
+      m_plan.fill(CutPosition::Pre, obj, w);
+      return;
+    }
+    if (passes) {
+      m_plan.fill(CutPosition::Post, obj, w);
+    }
+    m_plan.fillTrees(passes);
+    return;
+  }
   
   
   // Low-level management method(s).
   template <class T>
   void Operation<T>::init () {
+    if (plots().empty()) {
+      // Nothing to fill.
+      m_initialised = true;
+      return;
+    }
     assert ( this->dir() );
     
+    RootLock lock;
     this->dir()->cd();
     
     // Only add trees if there are actually non-trivial plotting macros registered.
@@ -144,6 +145,15 @@ namespace AnalysisTools {
     
     return;
   }
+
+  template <class T>
+  void Operation<T>::compile_ () {
+    assert( m_initialised );
+    TTree* preTree  = (m_trees.count(CutPosition::Pre)  ? m_trees[CutPosition::Pre] .get() : nullptr);
+    TTree* postTree = (m_trees.count(CutPosition::Post) ? m_trees[CutPosition::Post].get() : nullptr);
+    m_plan.compile(this->parent(), plots(CutPosition::Pre), plots(CutPosition::Post), preTree, postTree);
+    return;
+  }
   
 }
 
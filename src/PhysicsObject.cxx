@@ -1,5 +1,8 @@
 #include "AnalysisTools/PhysicsObject.h"
 
+// STL include(s).
+#include <stdexcept> /* std::out_of_range */
+
 namespace AnalysisTools {
 
     // Constructor(s).
@@ -7,27 +10,96 @@ namespace AnalysisTools {
     
     // Set method(s).
     void PhysicsObject::addInfo (const string& name, const double& val) {
-      if (m_info.count(name) > 0) {
-	FCTWARNING("Info '%s' already exists.", name.c_str());
+        addInfo(m_schema->key(name), val);
+        return;
+    }
+
+    void PhysicsObject::addInfo (const InfoKey& key, const double& val) {
+      if (key.schema != m_schema) {
+	addInfo(key.schema->name(key.slot), val);
+	return;
+      }
+      if (key.slot >= m_present.size()) {
+	m_values .resize(key.slot + 1, 0.);
+	m_present.resize(key.slot + 1, false);
+      }
+      if (m_present[key.slot]) {
+	FCTWARNING("Info '%s' already exists.", m_schema->name(key.slot).c_str());
       }
-        assert( m_info.count(name) == 0 );
-        m_info[name] = val;
+        assert( !m_present[key.slot] );
+        m_values [key.slot] = val;
+        m_present[key.slot] = true;
+        return;
+    }
+
+    void PhysicsObject::setSchema (InfoSchema* schema) {
+        assert( schema );
+        assert( m_present.empty() );
+        m_schema = schema;
+        return;
+    }
+
+    void PhysicsObject::setColumns (const InfoColumns* columns, const unsigned& index) {
+        assert( columns );
+        setSchema(columns->schema());
+        m_columns = columns;
+        m_index   = index;
+        return;
+    }
+
+    void PhysicsObject::detach () {
+        if (m_columns) {
+	  InfoKey key;
+	  key.schema = m_schema;
+	  for (key.slot = 0; key.slot < m_schema->size(); key.slot++) {
+	    if (!m_columns->has(key)) { continue; }
+	    if (key.slot < m_present.size() && m_present[key.slot]) { continue; }
+	    addInfo(key, m_columns->value(key, m_index));
+	  }
+	  m_columns = nullptr;
+	  m_index   = 0;
+        }
+        if (m_values.get_allocator().generation() != 0) {
+	  vector<double, ArenaAllocator<double> > values (m_values.begin(), m_values.end(), ArenaAllocator<double>::heap());
+	  m_values.swap(values);
+        }
+        if (m_present.get_allocator().generation() != 0) {
+	  vector<bool, ArenaAllocator<bool> > present (m_present.begin(), m_present.end(), ArenaAllocator<bool>::heap());
+	  m_present.swap(present);
+        }
         return;
     }
     
     
     // Get method(s).
     double PhysicsObject::info (const string& name) const {
-      if (m_info.count(name) == 0) {
-	FCTWARNING("Info '%s' was not found.", name.c_str());
-      }
-        assert( m_info.count(name) > 0 );
-        return m_info.at(name);
+        // Names not in the schema aren't registered, since no object using it can have them.
+        InfoKey key;
+        if (!m_schema->find(name, key)) {
+	  FCTWARNING("Info '%s' was not found.", name.c_str());
+	  assert( false );
+	  throw std::out_of_range("Info '" + name + "' was not found.");
+	}
+        return info(key);
     }
     
     
     // High-level management method(s).
     // ...
+
+
+    // Low-level management method(s).
+    double PhysicsObject::infoSlow_ (const InfoKey& key) const {
+      if (key.schema != m_schema) {
+	// Key from another collection's schema; look up by name instead.
+	return info(key.schema->name(key.slot));
+      }
+      if (key.slot >= m_present.size() || !m_present[key.slot]) {
+	FCTWARNING("Info '%s' was not found.", m_schema->name(key.slot).c_str());
+      }
+        assert( key.slot < m_present.size() && m_present[key.slot] );
+        return m_values.at(key.slot);
+    }
  
     
      // PhysicsObject-specific utility functions.
@@ -0,0 +1,87 @@
+#include "AnalysisTools/RangeSet.h"
+
+namespace AnalysisTools {
+
+  // Constructor(s).
+  RangeSet::RangeSet (const Ranges& ranges) {
+    add(ranges);
+  }
+
+
+  // Set method(s).
+  void RangeSet::clear () {
+    m_down.clear();
+    m_up.clear();
+    return;
+  }
+
+  void RangeSet::add (const Range& range) {
+    m_down.push_back(range.down());
+    m_up  .push_back(range.up());
+    normalise_();
+    return;
+  }
+
+  void RangeSet::add (const Ranges& ranges) {
+    for (const Range& range : ranges) {
+      m_down.push_back(range.down());
+      m_up  .push_back(range.up());
+    }
+    normalise_();
+    return;
+  }
+
+
+  // Get method(s).
+  Ranges RangeSet::ranges () const {
+    Ranges output;
+    for (unsigned i = 0; i < size(); i++) {
+      output.emplace_back(m_down[i], m_up[i]);
+    }
+    return output;
+  }
+
+
+  // High-level management method(s).
+  void RangeSet::contains (const float* values, const unsigned& N, unsigned char* mask) const {
+    if (size() <= s_maxBranchless) {
+      // Fixed, branch-free loop over the intervals for each value.
+      for (unsigned k = 0; k < N; k++) {
+	unsigned char passes = 0;
+	for (unsigned i = 0; i < size(); i++) {
+	  passes |= (values[k] >= m_down[i]) & (values[k] <= m_up[i]);
+	}
+	mask[k] = passes;
+      }
+    } else {
+      for (unsigned k = 0; k < N; k++) {
+	mask[k] = contains(values[k]);
+      }
+    }
+    return;
+  }
+
+
+  // Low-level management method(s).
+  void RangeSet::normalise_ () {
+    // Sort intervals by lower limit.
+    std::vector<unsigned> order (m_down.size());
+    for (unsigned i = 0; i < order.size(); i++) { order[i] = i; }
+    std::sort(order.begin(), order.end(), [this](const unsigned& a, const unsigned& b) { return m_down[a] < m_down[b]; });
+
+    // Merge overlapping (or touching) intervals. Since the limits are inclusive, this doesn't change which values are contained.
+    std::vector<float> down, up;
+    for (const unsigned& i : order) {
+      if (down.size() && m_down[i] <= up.back()) {
+	up.back() = std::max(up.back(), m_up[i]);
+      } else {
+	down.push_back(m_down[i]);
+	up  .push_back(m_up[i]);
+      }
+    }
+    m_down = std::move(down);
+    m_up   = std::move(up);
+    return;
+  }
+
+}
@@ -35,6 +35,7 @@ namespace AnalysisTools {
   /// High-level method(s).
   template<class T>
   void Retriever<T>::clear () {
+    unbind_();
     m_formulas.clear();
     m_initialised = false;
   }
@@ -60,7 +61,7 @@ namespace AnalysisTools {
     clearCache_();
 
     // Has to be called for _each_ formula, to fill data. (?)
-    for (const auto& f : m_formulas) { f->GetNdata(); }
+    for (const auto& f : m_formulas) { if (f) { f->GetNdata(); } }
 
     // Fill information.
     fillCache_();
@@ -105,6 +106,10 @@ namespace AnalysisTools {
 
     DEBUG("Setting up formulas.");
     for (const std::string& branch : m_branches) {
+      if (bind_(branch)) {
+	m_formulas.emplace_back(nullptr);
+	continue;
+      }
       m_formulas.push_back(makeUniqueMove<TTreeFormula>(new TTreeFormula(("f" + branch).c_str(), branch.c_str(), m_tree)));
       m_formulas.back()->SetQuickLoad(true);
     }
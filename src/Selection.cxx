@@ -53,9 +53,11 @@ namespace AnalysisTools {
             addCategory("Nominal");
         }
         lockCategories();
+        m_origin = ++m_nOrigins;
         for (const auto& category : this->m_categories) {
             addCut(cut, category, true);
         }
+        m_origin = 0;
         return;
     }
     
@@ -66,12 +68,14 @@ namespace AnalysisTools {
         std::regex pieces_regex(pattern);
         std::smatch pieces_match;
         bool hasMatch = false;
+        const unsigned origin = (m_origin ? m_origin : ++m_nOrigins);
         for (const auto& category : this->m_categories) {
             if (std::regex_match(category, pieces_match, pieces_regex)) {
                 
                 assert( hasCategory(category) );
                 if (!common && m_branch < 0) { m_branch = (int) m_operations[category].size(); }
-                this->m_operations[category].emplace_back( makeUniqueMove( new Cut<U>(cut) ) );
+                this->m_operations[category].emplace_back( makeUniqueMove( cut.clone() ) );
+                this->m_operations[category].back()->m_origin = origin;
                 this->grab( this->m_operations[category].back().get(), category );
                 hasMatch = true;
             }
@@ -204,9 +208,11 @@ namespace AnalysisTools {
             addCategory("Nominal");
         }
         lockCategories();
+        m_origin = ++m_nOrigins;
         for (const auto& category : this->m_categories) {
             addOperation(operation, category, true);
         }
+        m_origin = 0;
         return;
         
     }
@@ -226,12 +232,14 @@ namespace AnalysisTools {
       std::regex pieces_regex(pattern);
       std::smatch pieces_match;
       bool hasMatch = false;
+      const unsigned origin = (m_origin ? m_origin : ++m_nOrigins);
       for (const auto& category : this->m_categories) {
 	if (std::regex_match(category, pieces_match, pieces_regex)) {
 
 	  assert( hasCategory(category) );
 	  if (!common && m_branch < 0) { m_branch = (int) m_operations[category].size(); }
 	  this->m_operations[category].emplace_back( makeUniqueMove( new Operation<U>(operation) ) );
+	  this->m_operations[category].back()->m_origin = origin;
 	  this->grab( this->m_operations[category].back().get(), category );
 	  hasMatch = true;
 	}
@@ -401,12 +409,15 @@ namespace AnalysisTools {
     
     template <class T, class U>
     void Selection<T,U>::setupCutflow (const string& category) {
+        RootLock lock;
         this->dir()->cd(category.c_str());
         assert( hasCategory(category) );
         
+        // Pure filters (see Cut::setBookkeeping) have no bin of their own.
         unsigned int nCuts = 0;
         for (auto& iop : this->m_operations[category]) { // IOperation* iop
-	    if (dynamic_cast< Cut<U>* >(iop.get()) == nullptr) { continue; }
+	    const Cut<U>* cut = dynamic_cast< Cut<U>* >(iop.get());
+	    if (cut == nullptr || !cut->bookkeeping()) { continue; }
             nCuts++;
         }
 
@@ -417,11 +428,35 @@ namespace AnalysisTools {
         m_cutflow[category]->GetXaxis()->SetBinLabel(1, "All");
         unsigned int iCut = 1;
         for (auto& iop : this->m_operations[category]) { // IOperation*
-	    if (dynamic_cast< Cut<U>* >(iop.get()) == nullptr) { continue; }
+	    const Cut<U>* cut = dynamic_cast< Cut<U>* >(iop.get());
+	    if (cut == nullptr || !cut->bookkeeping()) { continue; }
             m_cutflow[category]->GetXaxis()->SetBinLabel(++iCut, iop->name().c_str());
         }
         return;
     }
+
+    template <class T, class U>
+    CutScheduler* Selection<T,U>::scheduler_ (const string& category, const unsigned& branch) {
+        if (m_warmup == 0) { return nullptr; }
+        CutScheduler& scheduler = m_schedulers[category];
+        if (!scheduler.initialised()) {
+	    std::vector<IOperation*> ops = operations(category);
+	    std::vector<bool> reorderable;
+	    for (IOperation* iop : ops) {
+	        const Cut<U>* cut = (iop->operationType() == OperationType::Cut ? static_cast< Cut<U>* >(iop) : nullptr);
+	        const bool commutative = cut && cut->commutative();
+
+		// Reordering must not change what the cut records, nor which candidates the cuts after it see.
+		const bool pure = cut && !cut->bookkeeping() && cut->plots().empty();
+		if (commutative && !pure) {
+		    WARNING("Cut '%s' is flagged as commutative, but records the candidates it sees. It is not reordered.", iop->name().c_str());
+		}
+		reorderable.push_back(commutative && pure);
+	    }
+	    scheduler.init(ops, reorderable, m_warmup, branch);
+        }
+        return &scheduler;
+    }
     
 }
 
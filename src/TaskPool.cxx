@@ -0,0 +1,134 @@
+#include "AnalysisTools/TaskPool.h"
+
+namespace AnalysisTools {
+
+  namespace {
+    // Whether the current thread is running a task.
+    thread_local bool t_inTask = false;
+  }
+
+
+  // Constructor(s).
+  TaskPool::TaskPool (const unsigned& nThreads) {
+    // The calling thread also executes tasks.
+    for (unsigned i = 1; i < nThreads; i++) {
+      m_workers.emplace_back(&TaskPool::work_, this);
+    }
+  }
+
+
+  // Destructor(s).
+  TaskPool::~TaskPool () {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_start.notify_all();
+    for (std::thread& worker : m_workers) {
+      worker.join();
+    }
+  }
+
+
+  // Get method(s).
+  bool TaskPool::inTask () {
+    return t_inTask;
+  }
+
+
+  // High-level management method(s).
+  void TaskPool::run (const std::vector< std::function<void()> >& tasks) {
+    run(tasks, std::vector< std::vector<unsigned> >(tasks.size()));
+    return;
+  }
+
+  void TaskPool::run (const std::vector< std::function<void()> >& tasks, const std::vector< std::vector<unsigned> >& inputs) {
+    if (tasks.empty()) { return; }
+    if (inputs.size() != tasks.size()) {
+      FCTWARNING("Got %lu tasks, but inputs for %lu. Exiting.", tasks.size(), inputs.size());
+      return;
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_tasks    = &tasks;
+    m_finished = 0;
+    m_pending.assign(tasks.size(), 0);
+    m_dependents.assign(tasks.size(), std::vector<unsigned>());
+    m_ready.clear();
+    for (unsigned i = 0; i < tasks.size(); i++) {
+      for (const unsigned& j : inputs[i]) {
+	if (j >= i) {
+	  FCTWARNING("Task %u takes task %u as input, which doesn't come before it. Ignoring.", i, j);
+	  continue;
+	}
+	m_pending[i]++;
+	m_dependents[j].push_back(i);
+      }
+      if (m_pending[i] == 0) { m_ready.push_back(i); }
+    }
+    m_generation++;
+    m_start.notify_all();
+
+    execute_(lock);
+
+    // Wait for all workers to have stopped looking for new tasks.
+    m_done.wait(lock, [this] { return m_active == 0; });
+    m_tasks = nullptr;
+    return;
+  }
+
+
+  // Low-level management method(s).
+  void TaskPool::work_ () {
+    unsigned generation = 0;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+      m_start.wait(lock, [this, &generation] { return m_stop || m_generation != generation; });
+      if (m_stop) { return; }
+      generation = m_generation;
+      if (!m_tasks) { continue; }
+      m_active++;
+      execute_(lock);
+      m_active--;
+      m_done.notify_all();
+    }
+    return;
+  }
+
+  void TaskPool::execute_ (std::unique_lock<std::mutex>& lock) {
+    const std::vector< std::function<void()> >& tasks = *m_tasks;
+    while (m_finished < tasks.size()) {
+      if (m_ready.empty()) {
+	m_progress.wait(lock);
+	continue;
+      }
+
+      // Start the earliest ready task.
+      std::vector<unsigned>::iterator next = std::min_element(m_ready.begin(), m_ready.end());
+      const unsigned i = *next;
+      m_ready.erase(next);
+
+      lock.unlock();
+      t_inTask = true;
+      tasks[i]();
+      t_inTask = false;
+      lock.lock();
+
+      m_finished++;
+      for (const unsigned& k : m_dependents[i]) {
+	if (--m_pending[k] == 0) { m_ready.push_back(k); }
+      }
+      m_progress.notify_all();
+    }
+    return;
+  }
+
+
+  // RootLock.
+  bool RootLock::s_concurrent = false;
+
+  std::mutex& RootLock::mutex () {
+    static std::mutex s_mutex;
+    return s_mutex;
+  }
+
+}
@@ -0,0 +1,39 @@
+#include "AnalysisTools/TreeBuffer.h"
+
+namespace AnalysisTools {
+
+  // Set method(s).
+  void TreeBuffer::setTree (TTree* tree, const std::vector< IPlotMacro* >& plots) {
+    m_tree  = tree;
+    m_plots = plots;
+    m_values.clear();
+    m_rows = 0;
+    return;
+  }
+
+
+  // High-level management method(s).
+  void TreeBuffer::add () {
+    assert( m_tree );
+    for (const IPlotMacro* plot : m_plots) {
+      m_values.push_back(plot->value());
+    }
+    m_rows++;
+    return;
+  }
+
+  void TreeBuffer::write () {
+    if (empty()) { return; }
+    const unsigned nPlots = m_plots.size();
+    for (unsigned row = 0; row < m_rows; row++) {
+      for (unsigned i = 0; i < nPlots; i++) {
+	m_plots[i]->fillDirectly(m_values[row * nPlots + i]);
+      }
+      m_tree->Fill();
+    }
+    m_values.clear();
+    m_rows = 0;
+    return;
+  }
+
+}
@@ -0,0 +1,171 @@
+/**
+ * @file   BatchTest.cxx
+ * @author Andreas Sogaard
+ * @brief  Check that running the final event selection in batch mode gives the same results and cutflows as running it on each event in turn, for collections whose info is read in place from vector info (see ObjectDefinition<TLorentzVector>), with and without the event arena.
+ */
+
+// STL include(s).
+#include <string>
+#include <vector>
+#include <memory> /* std::shared_ptr */
+#include <iostream>
+#include <cstdio> /* printf */
+#include <cstdlib> /* rand, srand */
+#include <cmath> /* std::abs */
+
+// ROOT include(s).
+#include "TFile.h"
+#include "TLorentzVector.h"
+
+// AnalysisTools include(s).
+#include "AnalysisTools/Analysis.h"
+#include "AnalysisTools/ObjectDefinition.h"
+#include "AnalysisTools/EventSelection.h"
+#include "AnalysisTools/CommonOperations.h"
+#include "AnalysisTools/EventArena.h"
+
+using namespace std;
+using namespace AnalysisTools;
+
+namespace {
+
+  unsigned nChecks   = 0;
+  unsigned nFailures = 0;
+
+  void check (const bool& ok, const std::string& what) {
+    nChecks++;
+    if (!ok) {
+      nFailures++;
+      printf("FAILED: %s\n", what.c_str());
+    }
+    return;
+  }
+
+  // Sum of the info 'x' of the objects in 'view'.
+  double sumX (const CollectionView& view) {
+    double sum = 0.;
+    for (const PhysicsObject* p : view) { sum += p->info("x"); }
+    return sum;
+  }
+
+  // Jets, with info 'x' and 'y' in separate vectors, as read from a tree.
+  struct Input {
+    std::vector<TLorentzVector> jets;
+    std::vector<float>          x;
+    std::vector<int>            y;
+    float                       weight = 1.;
+
+    void generate () {
+      jets.clear();
+      x.clear();
+      y.clear();
+      const unsigned n = rand() % 6;
+      for (unsigned j = 0; j < n; j++) {
+	TLorentzVector jet;
+	jet.SetPtEtaPhiM(20 + rand() % 200, (rand() % 500) / 100. - 2.5, 0.3 * j, 10.);
+	jets.push_back(jet);
+	x.push_back((rand() % 100) / 100.);
+	y.push_back(rand() % 3);
+      }
+      weight = 0.5 + (rand() % 100) / 50.;
+      return;
+    }
+  };
+
+  // Analysis selecting jets with x > 0.3 and y > 0, and events with sum(x) > 1 and a leading jet with x < 0.9.
+  void setup (Analysis& analysis, std::shared_ptr<TFile> file, Input& input) {
+    analysis.setOutput(file);
+    analysis.setWeight(&input.weight);
+
+    ObjectDefinition<TLorentzVector> jets ("Jets");
+    jets.setInput(&input.jets);
+    jets.addInfo("x", &input.x);
+    jets.addInfo("y", &input.y);
+    jets.addCut(get_cut_object_info("x").withRange(0.3, inf));
+    jets.addCut(get_cut_object_info("y").withRange(1., inf));
+
+    EventSelection selection ("Events");
+    selection.addCollection("Jets", "Jets");
+    selection.addCut(get_cut_event_sum_info("Jets", "x").withRange(1., inf));
+    selection.addOperation(get_operation_event_argmax_info("Jets", "x", "Leading"));
+    selection.addCut(get_cut_event_particle_info("Leading", "x").withRange(-inf, 0.9));
+
+    analysis.addSelection(&jets);
+    analysis.addSelection(&selection);
+    return;
+  }
+
+  EventSelection* eventSelection (Analysis& analysis) {
+    return dynamic_cast<EventSelection*>(analysis.selections("Nominal").back().get());
+  }
+
+  void testBatch (const unsigned& batchSize, const bool& arena) {
+    EventArena::setEnabled(arena);
+    std::shared_ptr<TFile> file (new TFile("BatchTest.root", "RECREATE"));
+    Input input;
+    Analysis reference ("Reference");
+    Analysis batched   ("Batched");
+    setup(reference, file, input);
+    setup(batched,   file, input);
+    batched.setBatchSize(batchSize);
+
+    // Results, and sum of the info of the selected jets, of each event.
+    std::vector<bool>   referencePassed, batchedPassed;
+    std::vector<double> referenceSums,   batchedSums;
+    Analysis::BatchCallback callback = [&] (const unsigned& index, const bool& passed) {
+      batchedPassed.push_back(passed);
+      batchedSums  .push_back(sumX(eventSelection(batched)->batchEvent("Nominal", index).collection("Jets")));
+    };
+
+    srand(7);
+    const unsigned nEvents = 500;
+    for (unsigned i = 0; i < nEvents; i++) {
+      if (arena) { EventArena::reset(); }
+      input.generate();
+      referencePassed.push_back(reference.run("Nominal"));
+      CollectionView view;
+      view.reset(*dynamic_cast< ObjectDefinition<TLorentzVector>* >(reference.selections("Nominal").front().get())->result("Nominal"));
+      referenceSums.push_back(sumX(view));
+      batched.runBuffered("Nominal", callback);
+    }
+    batched.flush("Nominal", callback);
+
+    const std::string suffix = " (batches of " + std::to_string(batchSize) + (arena ? ", with arena)" : ")");
+    check(batchedPassed.size() == nEvents, "all events reported" + suffix);
+    if (batchedPassed.size() != nEvents) { return; }
+    unsigned nPassed = 0, nDifferent = 0;
+    for (unsigned i = 0; i < nEvents; i++) {
+      nPassed    += referencePassed[i];
+      nDifferent += (referencePassed[i] != batchedPassed[i]) || std::abs(referenceSums[i] - batchedSums[i]) > 1e-6;
+    }
+    check(nPassed > 0 && nPassed < nEvents, "some, but not all, events pass" + suffix);
+    check(nDifferent == 0, "same results and jet info for each event" + suffix);
+
+    // The cutflow is filled per batch rather than per event, so only agrees up to rounding.
+    TH1F* referenceCutflow = eventSelection(reference)->cutflow("Nominal");
+    TH1F* batchedCutflow   = eventSelection(batched)  ->cutflow("Nominal");
+    for (int bin = 1; bin <= 3; bin++) {
+      const double expected = referenceCutflow->GetBinContent(bin);
+      check(std::abs(batchedCutflow->GetBinContent(bin) - expected) <= 1e-5 * std::abs(expected), "cutflow bin " + std::to_string(bin) + suffix);
+    }
+    return;
+  }
+
+} // namespace
+
+
+int main (int argc, char* argv[]) {
+
+  cout << "=====================================================================" << endl;
+  cout << " Testing batch mode." << endl;
+  cout << "---------------------------------------------------------------------" << endl;
+
+  for (const bool arena : { false, true }) {
+    testBatch(1,    arena);
+    testBatch(16,   arena);
+    testBatch(1000, arena);
+  }
+
+  printf("%u/%u checks passed.\n", nChecks - nFailures, nChecks);
+  return (nFailures == 0 ? 0 : 1);
+}
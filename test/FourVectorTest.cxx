@@ -0,0 +1,142 @@
+/**
+ * @file   FourVectorTest.cxx
+ * @author Andreas Sogaard
+ * @brief  Check that FourVector reproduces the kinematics of TLorentzVector, to float precision, including for vectors along the beam axis.
+ */
+
+// STL include(s).
+#include <string>
+#include <vector>
+#include <iostream>
+#include <cstdio> /* printf */
+#include <cmath> /* std::abs, std::isfinite */
+#include <random> /* std::mt19937 */
+
+// ROOT include(s).
+#include "TLorentzVector.h"
+
+// AnalysisTools include(s).
+#include "AnalysisTools/FourVector.h"
+
+using namespace std;
+using namespace AnalysisTools;
+
+namespace {
+
+  unsigned nChecks   = 0;
+  unsigned nFailures = 0;
+
+  void check (const bool& ok, const std::string& what) {
+    nChecks++;
+    if (!ok) {
+      nFailures++;
+      printf("FAILED: %s\n", what.c_str());
+    }
+    return;
+  }
+
+  // Whether 'value' agrees with 'reference' to a relative precision 'tolerance', with respect to 'scale'.
+  bool close (const double& value, const double& reference, const double& scale, const double& tolerance = 1e-5) {
+    return std::isfinite(value) && std::abs(value - reference) <= tolerance * std::max(std::abs(scale), 1.);
+  }
+
+  bool finite (const FourVector& v) {
+    return std::isfinite(v.Pt()) && std::isfinite(v.Eta()) && std::isfinite(v.Phi()) && std::isfinite(v.M()) &&
+           std::isfinite(v.Px()) && std::isfinite(v.Py()) && std::isfinite(v.Pz()) && std::isfinite(v.E());
+  }
+
+  // Compare the Cartesian components, which any two representations of the same vector share, relative to 'scale' (by default the energy).
+  void compare (const FourVector& v, const TLorentzVector& reference, const std::string& what, double scale = 0.) {
+    if (scale == 0.) { scale = reference.E(); }
+    check(finite(v), what + ": finite components");
+    check(close(v.Px(), reference.Px(), scale), what + ": px");
+    check(close(v.Py(), reference.Py(), scale), what + ": py");
+    check(close(v.Pz(), reference.Pz(), scale), what + ": pz");
+    check(close(v.E(),  reference.E(),  scale), what + ": E");
+    return;
+  }
+
+
+  void testRandom (std::mt19937& rng) {
+    std::uniform_real_distribution<double> pt  (1., 1000.);
+    std::uniform_real_distribution<double> eta (-5., 5.);
+    std::uniform_real_distribution<double> phi (-M_PI, M_PI);
+    std::uniform_real_distribution<double> m   (0., 200.);
+    for (unsigned k = 0; k < 1000; k++) {
+      TLorentzVector reference;
+      reference.SetPtEtaPhiM(pt(rng), eta(rng), phi(rng), m(rng));
+      const FourVector v (reference);
+      const std::string what = "random vector " + std::to_string(k);
+      check(close(v.Pt(),  reference.Pt(),  reference.Pt()), what + ": pt");
+      check(close(v.Eta(), reference.Eta(), 1.),             what + ": eta");
+      check(close(v.Phi(), reference.Phi(), 1.),             what + ": phi");
+      compare(v, reference, what);
+
+      // Round trip.
+      const TLorentzVector back = v.lorentzVector();
+      check(close(back.E(), reference.E(), reference.E()), what + ": round trip");
+    }
+    return;
+  }
+
+
+  void testBeamAxis () {
+    for (const double pz : { 100., -100., 1e-3, 6500. }) {
+      const std::string what = "beam-axis vector with pz = " + std::to_string(pz);
+
+      // From Cartesian components, and from a TLorentzVector.
+      TLorentzVector reference (0., 0., pz, std::abs(pz));
+      FourVector v;
+      v.SetXYZM(0., 0., pz, 0.);
+      compare(v, reference, what + ", SetXYZM");
+      compare(FourVector(reference), reference, what + ", from TLorentzVector");
+      check(v.Pt() < 1e-15 * std::abs(pz),   what + ": negligible pt");
+      check(v.Eta() * pz > 0 && std::abs(v.Eta()) > 40., what + ": large eta, with the sign of pz");
+
+      // Sums and differences involving the vector.
+      TLorentzVector jet;
+      jet.SetPtEtaPhiM(50., 1.2, 0.3, 10.);
+      FourVector sum (jet);
+      sum += v;
+      compare(sum, jet + reference, what + ", sum");
+      FourVector difference (sum);
+      difference -= v;
+      compare(difference, jet, what + ", sum minus the vector", sum.E()); // Cancellation; only exact to the precision of the sum.
+      FourVector twice (v);
+      twice += v;
+      compare(twice, reference + reference, what + ", sum with itself");
+      FourVector scaled (v);
+      scaled *= 2.;
+      TLorentzVector scaledReference (reference);
+      scaledReference *= 2.;
+      compare(scaled, scaledReference, what + ", scaled");
+    }
+
+    // Almost along the beam axis, such that cos(theta) rounds to one.
+    TLorentzVector reference (1e-9, 0., 100., 100.);
+    FourVector v (reference);
+    compare(v, reference, "vector at 1e-11 rad from the beam axis");
+
+    // Zero vector.
+    FourVector zero;
+    zero.SetXYZM(0., 0., 0., 0.);
+    check(finite(zero) && zero.Pt() == 0 && zero.Eta() == 0 && zero.E() == 0, "zero vector");
+    return;
+  }
+
+} // namespace
+
+
+int main (int argc, char* argv[]) {
+
+  cout << "=====================================================================" << endl;
+  cout << " Testing FourVector." << endl;
+  cout << "---------------------------------------------------------------------" << endl;
+
+  std::mt19937 rng (42);
+  testRandom(rng);
+  testBeamAxis();
+
+  printf("%u/%u checks passed.\n", nChecks - nFailures, nChecks);
+  return (nFailures == 0 ? 0 : 1);
+}
@@ -0,0 +1,201 @@
+/**
+ * @file   KernelsTest.cxx
+ * @author Andreas Sogaard
+ * @brief  Check that the column-wise cut kernels give bit-exact the same pass/fail decisions as evaluating cuts one object at a time.
+ */
+
+// STL include(s).
+#include <string>
+#include <vector>
+#include <iostream>
+#include <cstdio> /* printf */
+#include <cstring> /* std::memcmp */
+#include <cmath> /* NAN, INFINITY */
+#include <limits> /* std::numeric_limits */
+#include <random> /* std::mt19937 */
+
+// AnalysisTools include(s).
+#include "AnalysisTools/PhysicsObject.h"
+#include "AnalysisTools/Range.h"
+#include "AnalysisTools/RangeSet.h"
+#include "AnalysisTools/Kernels.h"
+#include "AnalysisTools/Cut.h"
+#include "AnalysisTools/StaticCut.h"
+#include "AnalysisTools/ExpressionCut.h"
+#include "AnalysisTools/CommonOperations.h"
+
+using namespace std;
+using namespace AnalysisTools;
+
+namespace {
+
+  unsigned nChecks   = 0;
+  unsigned nFailures = 0;
+
+  void check (const bool& ok, const std::string& what) {
+    nChecks++;
+    if (!ok) {
+      nFailures++;
+      printf("FAILED: %s\n", what.c_str());
+    }
+    return;
+  }
+
+  // Values hitting all the special cases of the range test: boundaries, signed zeros, infinities, NaN and denormals.
+  std::vector<float> testValues (std::mt19937& rng, const unsigned& N, const RangeSet& ranges) {
+    std::vector<float> special = { 0.f, -0.f, 1.f, -1.f, NAN, -NAN, INFINITY, -INFINITY,
+				   std::numeric_limits<float>::denorm_min(), std::numeric_limits<float>::max() };
+    for (unsigned i = 0; i < ranges.size(); i++) {
+      special.push_back(ranges.down(i));
+      special.push_back(ranges.up(i));
+      special.push_back(std::nextafter(ranges.down(i), -INFINITY));
+      special.push_back(std::nextafter(ranges.up(i),    INFINITY));
+    }
+    std::uniform_real_distribution<float> uniform (-10., 10.);
+    std::uniform_int_distribution<unsigned> pick (0, special.size() - 1);
+    std::vector<float> values;
+    for (unsigned k = 0; k < N; k++) {
+      values.push_back(k % 3 == 0 ? special[pick(rng)] : uniform(rng));
+    }
+    return values;
+  }
+
+  // Reference: the range test done by Cut<T> for a single object.
+  unsigned char scalarPasses (const float& val, const RangeSet& ranges) {
+    return ranges.empty() ? (bool) val : ranges.contains(val);
+  }
+
+  std::string describe (const RangeSet& ranges, const unsigned& N, const bool& vectorised) {
+    return std::to_string(ranges.size()) + " range(s), " + std::to_string(N) + " value(s), " + (vectorised ? "vectorised" : "scalar");
+  }
+
+
+  void testRanges (std::mt19937& rng) {
+    std::vector<RangeSet> sets (5);
+    sets[1].add(Range(-2.f, 2.f));
+    sets[2].add(Range(-2.5f, -1.f));
+    sets[2].add(Range( 1.f,   2.5f));
+    sets[3].add(Range(0.f, 0.f));
+    sets[3].add(Range(-INFINITY, -5.f));
+    sets[3].add(Range(5.f, INFINITY));
+    for (unsigned i = 0; i < 2 * RangeSet::s_maxBranchless; i++) {
+      sets[4].add(Range(-9.f + 2 * i, -8.5f + 2 * i)); // Above the limit for the vectorised test.
+    }
+
+    for (const RangeSet& ranges : sets) {
+      for (unsigned N = 0; N < 40; N++) {
+	const std::vector<float> values = testValues(rng, N, ranges);
+	std::vector<unsigned char> reference;
+	for (const float& val : values) { reference.push_back(scalarPasses(val, ranges)); }
+
+	for (const bool vectorised : { false, true }) {
+	  setVectorisedKernels(vectorised);
+	  std::vector<unsigned char> mask;
+	  kernelRanges(values, ranges, mask);
+	  check(mask == reference, "kernelRanges, " + describe(ranges, N, vectorised));
+	}
+      }
+    }
+    setVectorisedKernels(true);
+    return;
+  }
+
+
+  PhysicsObjects testObjects (std::mt19937& rng, const unsigned& N) {
+    std::uniform_real_distribution<float> pt  (0., 500.);
+    std::uniform_real_distribution<float> eta (-3., 3.);
+    std::uniform_real_distribution<float> phi (-3.14, 3.14);
+    std::uniform_real_distribution<float> m   (0., 200.);
+    PhysicsObjects objects (N);
+    for (unsigned k = 0; k < N; k++) {
+      objects[k].SetPtEtaPhiM(pt(rng), eta(rng), phi(rng), m(rng));
+      objects[k].addInfo("rhoDDT", (k % 7 == 0 ? NAN : eta(rng)));
+    }
+    return objects;
+  }
+
+  std::vector<unsigned> testIndices (std::mt19937& rng, const unsigned& N) {
+    std::bernoulli_distribution keep (0.7);
+    std::vector<unsigned> indices;
+    for (unsigned k = 0; k < N; k++) {
+      if (keep(rng)) { indices.push_back(k); }
+    }
+    return indices;
+  }
+
+  // Compare the column kernel of 'F' to the functor itself, bitwise.
+  template <class F>
+  void testColumn (const F& f, const PhysicsObjects& objects, const std::vector<unsigned>& indices, const std::string& name) {
+    std::vector<float> values;
+    f.column(objects, indices, values);
+    bool same = (values.size() == indices.size());
+    for (unsigned k = 0; same && k < indices.size(); k++) {
+      const float reference = f(objects[indices[k]]);
+      same &= (std::memcmp(&values[k], &reference, sizeof(float)) == 0);
+    }
+    check(same, "column kernel for '" + name + "', " + std::to_string(indices.size()) + " object(s)");
+    return;
+  }
+
+  // Compare the surviving indices of cut applied to a whole collection to applying the cut one object at a time.
+  void testCut (Cut<PhysicsObject>& cut, const PhysicsObjects& objects, const std::vector<unsigned>& indices) {
+    std::vector<unsigned> reference;
+    for (const unsigned& i : indices) {
+      if (cut.apply(objects[i])) { reference.push_back(i); }
+    }
+    for (const bool vectorised : { false, true }) {
+      setVectorisedKernels(vectorised);
+      std::vector<unsigned> survivors = indices;
+      cut.apply(objects, survivors);
+      check(survivors == reference, "cut '" + cut.name() + "', " + std::to_string(indices.size()) + " object(s), " + (vectorised ? "vectorised" : "scalar"));
+    }
+    setVectorisedKernels(true);
+    return;
+  }
+
+
+  void testCollections (std::mt19937& rng) {
+    // Pure filters, such that the column path is used (see Cut::setBookkeeping).
+    auto pt     = cut_pt .withRange(200., inf);
+    auto eta    = cut_eta.withRange(-2., 2.);
+    auto m      = cut_m  .withRange(50., 150.);
+    auto rhoDDT = get_cut_object_info("rhoDDT").withRange(-1.5, 1.5);
+    auto expr   = Cut<PhysicsObject>::fromExpression("pt > 200 && abs(eta) < 2 && info(rhoDDT) > -1.5");
+    for (Cut<PhysicsObject>* cut : std::vector< Cut<PhysicsObject>* >{ &pt, &eta, &m, &rhoDDT, &expr }) {
+      cut->setBookkeeping(false);
+    }
+
+    for (unsigned N = 0; N < 40; N++) {
+      const PhysicsObjects        objects = testObjects(rng, N);
+      const std::vector<unsigned> indices = testIndices(rng, N);
+
+      testColumn(ObjectPt(),            objects, indices, "pt");
+      testColumn(ObjectEta(),           objects, indices, "eta");
+      testColumn(ObjectM(),             objects, indices, "m");
+      testColumn(ObjectInfo("rhoDDT"),  objects, indices, "rhoDDT");
+
+      testCut(pt,     objects, indices);
+      testCut(eta,    objects, indices);
+      testCut(m,      objects, indices);
+      testCut(rhoDDT, objects, indices);
+      testCut(expr,   objects, indices);
+    }
+    return;
+  }
+
+} // namespace
+
+
+int main (int argc, char* argv[]) {
+
+  cout << "=====================================================================" << endl;
+  cout << " Testing column-wise cut kernels." << endl;
+  cout << "---------------------------------------------------------------------" << endl;
+
+  std::mt19937 rng (42);
+  testRanges(rng);
+  testCollections(rng);
+
+  printf("%u/%u checks passed.\n", nChecks - nFailures, nChecks);
+  return (nFailures == 0 ? 0 : 1);
+}
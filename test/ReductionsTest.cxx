@@ -0,0 +1,199 @@
+/**
+ * @file   ReductionsTest.cxx
+ * @author Andreas Sogaard
+ * @brief  Check the reductions over collections of physics objects, and the event-level cuts and operations built on them, including for ties, empty collections, and missing particles.
+ */
+
+// STL include(s).
+#include <string>
+#include <vector>
+#include <iostream>
+#include <cstdio> /* printf */
+#include <cmath> /* NAN, INFINITY */
+
+// AnalysisTools include(s).
+#include "AnalysisTools/PhysicsObject.h"
+#include "AnalysisTools/CollectionView.h"
+#include "AnalysisTools/RangeSet.h"
+#include "AnalysisTools/Event.h"
+#include "AnalysisTools/Cut.h"
+#include "AnalysisTools/Operation.h"
+#include "AnalysisTools/CommonOperations.h"
+
+using namespace std;
+using namespace AnalysisTools;
+
+namespace {
+
+  unsigned nChecks   = 0;
+  unsigned nFailures = 0;
+
+  void check (const bool& ok, const std::string& what) {
+    nChecks++;
+    if (!ok) {
+      nFailures++;
+      printf("FAILED: %s\n", what.c_str());
+    }
+    return;
+  }
+
+  // Objects with pt 10, 20, ..., and info 'x' as given.
+  PhysicsObjects makeObjects (const std::vector<float>& xs) {
+    PhysicsObjects objects (xs.size());
+    for (unsigned k = 0; k < xs.size(); k++) {
+      objects[k].SetPtEtaPhiM(10. * (k + 1), 0., 0., 0.);
+      objects[k].addInfo("x", xs[k]);
+    }
+    return objects;
+  }
+
+  // Positions of the objects in 'view' within 'objects'.
+  std::vector<unsigned> positions (const CollectionView& view, const PhysicsObjects& objects) {
+    std::vector<unsigned> output;
+    for (const PhysicsObject* p : view) { output.push_back(p - objects.data()); }
+    return output;
+  }
+
+  // Whether the cut variable of 'cut' for 'event' is 'value'.
+  bool cutValueIs (Cut<Event> cut, const Event& event, const float& value) {
+    Cut<Event> test = cut.withRange(value);
+    test.setBookkeeping(false);
+    return test.apply(event);
+  }
+
+
+  void testArgminArgmax () {
+    const ObjectInfo x ("x");
+
+    const PhysicsObjects ties = makeObjects({ 3., 1., 5., 1., 5. });
+    const CollectionView view (ties);
+    check(collectionArgmin(view, x) == &ties[1], "argmin, ties go to the first object");
+    check(collectionArgmax(view, x) == &ties[2], "argmax, ties go to the first object");
+
+    const PhysicsObjects none;
+    check(collectionArgmin(CollectionView(none), x) == nullptr, "argmin, empty collection");
+    check(collectionArgmax(CollectionView(none), x) == nullptr, "argmax, empty collection");
+
+    const PhysicsObjects nans = makeObjects({ NAN, 2., NAN });
+    check(collectionArgmin(CollectionView(nans), x) == &nans[1], "argmin, NaN values are skipped");
+    check(collectionArgmax(CollectionView(nans), x) == &nans[1], "argmax, NaN values are skipped");
+
+    const PhysicsObjects allNans = makeObjects({ NAN, NAN });
+    check(collectionArgmin(CollectionView(allNans), x) == nullptr, "argmin, only NaN values");
+    check(collectionArgmax(CollectionView(allNans), x) == nullptr, "argmax, only NaN values");
+
+    const PhysicsObjects infs = makeObjects({ INFINITY, -INFINITY });
+    check(collectionArgmin(CollectionView(infs), x) == &infs[1], "argmin, -inf is chosen");
+    check(collectionArgmax(CollectionView(infs), x) == &infs[0], "argmax, +inf is chosen");
+    return;
+  }
+
+
+  void testTopK () {
+    const ObjectInfo x ("x");
+    const PhysicsObjects objects = makeObjects({ 3., 1., 5., 1., 5. });
+    const CollectionView view (objects);
+    CollectionView output;
+
+    collectionTopK(view, x, 3, output);
+    check(positions(output, objects) == std::vector<unsigned>({ 2, 4, 0 }), "top-k, ties keep their order");
+
+    collectionTopK(view, x, 10, output);
+    check(positions(output, objects) == std::vector<unsigned>({ 2, 4, 0, 1, 3 }), "top-k, k larger than the collection");
+
+    collectionTopK(view, x, 0, output);
+    check(output.size() == 0, "top-k, k = 0");
+
+    const PhysicsObjects none;
+    collectionTopK(CollectionView(none), x, 3, output);
+    check(output.size() == 0, "top-k, empty collection");
+
+    // Subset of a collection.
+    CollectionView subset (objects);
+    subset.indices() = { 4, 1, 3 };
+    collectionTopK(subset, x, 2, output);
+    check(positions(output, objects) == std::vector<unsigned>({ 4, 1 }), "top-k, view of part of a collection");
+    return;
+  }
+
+
+  void testSums () {
+    const ObjectInfo x ("x");
+    const PhysicsObjects objects = makeObjects({ 3., 1., 5., 1., 5. });
+    const CollectionView view (objects);
+    const PhysicsObjects none;
+
+    check(collectionSum(view, x) == 15., "sum");
+    check(collectionSum(CollectionView(none), x) == 0., "sum, empty collection");
+    check(collectionSum(view, ObjectInfo("x", 2.)) == 30., "sum, scaled");
+
+    check(collectionScalarSumPt(view) == 150., "scalar sum pt");
+    check(collectionScalarSumPt(CollectionView(none)) == 0., "scalar sum pt, empty collection");
+
+    RangeSet ranges;
+    ranges.add(Range(1., 3.));
+    check(collectionCountIf(view, x, ranges) == 3, "count, boundaries included");
+    check(collectionCountIf(CollectionView(none), x, ranges) == 0, "count, empty collection");
+    check(collectionCountIf(view, x, RangeSet()) == 0, "count, no ranges");
+    return;
+  }
+
+
+  void testEventHelpers () {
+    PhysicsObjects jets = makeObjects({ 3., 1., 5., 1., 5. });
+    PhysicsObjects none;
+
+    Event event;
+    event.addCollection("Jets",   &jets);
+    event.addCollection("NoJets", &none);
+    event.addInfo("a", 2.);
+
+    // Cuts.
+    check(cutValueIs(get_cut_num("Jets"),   event, 5), "number of objects");
+    check(cutValueIs(get_cut_num("NoJets"), event, 0), "number of objects, empty collection");
+    check(cutValueIs(get_cut_event_info("a", 3.), event, 6.), "event info, scaled");
+    check(cutValueIs(get_cut_event_hasInfo("a"), event, 1), "event has info");
+    check(cutValueIs(get_cut_event_hasInfo("missing"), event, 0), "event has info, missing info");
+
+    check(cutValueIs(get_cut_event_leading_info("Jets", "x"),   event, 5.),     "info of the leading object");
+    check(cutValueIs(get_cut_event_leading_info("NoJets", "x"), event, -9999.), "info of the leading object, empty collection");
+    check(cutValueIs(get_cut_event_sum_info("Jets", "x"),       event, 15.),    "sum of info");
+    check(cutValueIs(get_cut_event_sum_info("NoJets", "x"),     event, 0.),     "sum of info, empty collection");
+    check(cutValueIs(get_cut_event_count_info("Jets", "x", { Range(1., 3.) }), event, 3), "count of info in range");
+    check(cutValueIs(get_cut_event_count_info("NoJets", "x", { Range(1., 3.) }), event, 0), "count of info in range, empty collection");
+    check(cutValueIs(get_cut_event_scalar_sum_pt("Jets"),   event, 150.), "scalar sum pt");
+    check(cutValueIs(get_cut_event_scalar_sum_pt("NoJets"), event, 0.),   "scalar sum pt, empty collection");
+
+    // Operations; particles are set by reference to the chosen object, or not at all.
+    Operation<Event> argmin = get_operation_event_argmin_info("Jets", "x", "Min");
+    Operation<Event> argmax = get_operation_event_argmax_info("Jets", "x", "Max");
+    Operation<Event> empty  = get_operation_event_argmax_info("NoJets", "x", "None");
+    argmin.apply(event);
+    argmax.apply(event);
+    empty .apply(event);
+    check(event.hasParticle("Min") && &event.particle("Min") == &jets[1], "argmin operation, ties go to the first object");
+    check(event.hasParticle("Max") && &event.particle("Max") == &jets[2], "argmax operation, ties go to the first object");
+    check(!event.hasParticle("None"), "argmax operation, empty collection");
+
+    check(cutValueIs(get_cut_event_particle_info("Max", "x"),  event, 5.),     "info of particle");
+    check(cutValueIs(get_cut_event_particle_info("None", "x"), event, -9999.), "info of particle, missing particle");
+    return;
+  }
+
+} // namespace
+
+
+int main (int argc, char* argv[]) {
+
+  cout << "=====================================================================" << endl;
+  cout << " Testing collection reductions." << endl;
+  cout << "---------------------------------------------------------------------" << endl;
+
+  testArgminArgmax();
+  testTopK();
+  testSums();
+  testEventHelpers();
+
+  printf("%u/%u checks passed.\n", nChecks - nFailures, nChecks);
+  return (nFailures == 0 ? 0 : 1);
+}